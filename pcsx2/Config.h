@@ -299,6 +299,10 @@ struct Pcsx2Config
 
 		int		VsyncQueueSize;
 
+		// usable size of the MTGS ringbuffer, as a power of 2 in qwc (12 to 19).  Smaller
+		// rings bound how far the EE can run ahead of the GS.
+		int		RingSizeFactor;
+
 		bool		FrameLimitEnable;
 		bool		FrameSkipEnable;
 		VsyncMode	VsyncEnable;
@@ -320,6 +324,7 @@ struct Pcsx2Config
 			return
 				OpEqu( SynchronousMTGS )		&&
 				OpEqu( VsyncQueueSize )			&&
+				OpEqu( RingSizeFactor )			&&
 				
 				OpEqu( FrameSkipEnable )		&&
 				OpEqu( FrameLimitEnable )		&&
@@ -397,11 +402,16 @@ struct Pcsx2Config
 				IntcStat		:1,		// tells Pcsx2 to fast-forward through intc_stat waits.
 				WaitLoop		:1,		// enables constant loop detection and fast-forwarding
 				vuFlagHack		:1,		// microVU specific flag hack
-				vuThread        :1;		// Enable Threaded VU1
+				vuThread        :1,		// Enable Threaded VU1
+				ipuThread       :1,		// Enable Threaded IPU decoding
+				iopThread       :1,		// Enable Threaded IOP (experimental)
+				hwPoll          :1,		// fast-forwards through DMAC/VIF/GIF register polling (GameDB)
+				vu0Thread       :1;		// Enable Threaded VU0 micro mode (experimental)
 		BITFIELD_END
 
 		s8	EECycleRate;		// EE cycle rate selector (1.0, 1.5, 2.0)
 		u8	EECycleSkip;		// EE Cycle skip factor (0, 1, 2, or 3)
+		u16	IopSkew;			// EE cycles the EE may run ahead of a threaded IOP slice
 
 		SpeedhackOptions();
 		void LoadSave( IniInterface& conf );
@@ -409,7 +419,7 @@ struct Pcsx2Config
 
 		bool operator ==( const SpeedhackOptions& right ) const
 		{
-			return OpEqu( bitset ) && OpEqu( EECycleRate ) && OpEqu( EECycleSkip );
+			return OpEqu( bitset ) && OpEqu( EECycleRate ) && OpEqu( EECycleSkip ) && OpEqu( IopSkew );
 		}
 
 		bool operator !=( const SpeedhackOptions& right ) const
@@ -527,7 +537,10 @@ TraceLogFilters&				SetTraceConfig();
 
 // ------------ CPU / Recompiler Options ---------------
 
+#define THREAD_VU0					(EmuConfig.Cpu.Recompiler.UseMicroVU0 && EmuConfig.Speedhacks.vu0Thread)
 #define THREAD_VU1					(EmuConfig.Cpu.Recompiler.UseMicroVU1 && EmuConfig.Speedhacks.vuThread)
+#define THREAD_IPU					(EmuConfig.Speedhacks.ipuThread)
+#define THREAD_IOP					(EmuConfig.Speedhacks.iopThread)
 #define CHECK_MICROVU0				(EmuConfig.Cpu.Recompiler.UseMicroVU0)
 #define CHECK_MICROVU1				(EmuConfig.Cpu.Recompiler.UseMicroVU1)
 #define CHECK_EEREC					(EmuConfig.Cpu.Recompiler.EnableEE && GetCpuProviders().IsRecAvailable_EE())
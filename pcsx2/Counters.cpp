@@ -31,6 +31,7 @@
 #include "ps2/HwInternal.h"
 
 #include "Sio.h"
+#include "MTIOP.h"
 
 #ifndef DISABLE_RECORDING
 #	include "Recording/RecordingControls.h"
@@ -493,7 +494,8 @@ static __fi void VSyncEnd(u32 sCycle)
 
 	g_FrameCount++;
 
-
+	g_eeIdleCyclesFrame = g_eeIdleCycles;
+	g_eeIdleCycles = 0;
 
 	hwIntcIrq(INTC_VBLANK_E);  // HW Irq
 	psxVBlankEnd(); // psxCounters vBlank End
@@ -504,6 +506,9 @@ static __fi void VSyncEnd(u32 sCycle)
 	if (!(g_FrameCount % 60))
 		sioNextFrame();
 
+	if (THREAD_IOP)
+		iopThread.ReportSyncStats();
+
 	frameLimit(); // limit FPS
 
 	//Do this here, breaks Dynasty Warriors otherwise.
@@ -501,4 +501,155 @@ namespace MIPSAnalyst
 
 		return info;
 	}
+
+	// The idea here is that as long as a loop doesn't write to a register it's already read
+	// (excepting registers initialised with constants or memory loads) or use any instructions
+	// which alter the machine state apart from registers, it will do the same thing on every
+	// iteration.  Forward branches are fine (they either leave the loop or skip some of it),
+	// but calls and inner loops are not.  A register written in a part of the loop a branch
+	// may skip doesn't count as initialised, since it may still hold last iteration's value.
+	// TODO: special handling for counting loops.  God of war wastes time in a loop which just
+	// counts to some large number and does nothing else, many other games use a counter as a
+	// timeout on a register read.  AFAICS the only way to optimise this for non-const cases
+	// without a significant loss in cycle accuracy is with a division, but games would probably
+	// be happy with time wasting loops completing in 0 cycles and timeouts waiting forever.
+	bool IsIdleLoop(u32 start, u32 end)
+	{
+		if (end < start + 8)
+			return false;
+
+		const u32 branch = end - 8;
+		{
+			u32 op = r5900Debug.read32(branch);
+			const R5900::OPCODE& opcode = R5900::GetInstruction(op);
+
+			if (!(opcode.flags & IS_BRANCH) || (opcode.flags & IS_LINKED))
+				return false;
+
+			u32 target;
+			switch (opcode.flags & BRANCHTYPE_MASK)
+			{
+			case BRANCHTYPE_JUMP:
+				target = (branch & 0xF0000000) | ((op&0x03FFFFFF) << 2);
+				break;
+			case BRANCHTYPE_BRANCH:
+			case BRANCHTYPE_BC1:
+				target = branch + 4 + ((signed short)(op&0xFFFF)<<2);
+				break;
+			default:
+				return false;
+			}
+
+			if (target != start)
+				return false;
+		}
+
+		u32 reads = 0, loads = 1;
+		u32 skipFrom = 0, skipEnd = 0; // part of the loop a forward branch may skip
+
+		for (u32 addr = start; addr < end; addr += 4)
+		{
+			if (addr == branch)
+				continue;
+
+			const bool skippable = addr >= skipFrom && addr < skipEnd;
+			u32 op = r5900Debug.read32(addr);
+			const u32 opc = MIPS_GET_OP(op);
+			const u32 func = MIPS_GET_FUNC(op);
+			const u32 rs = MIPS_GET_RS(op), rt = MIPS_GET_RT(op), rd = MIPS_GET_RD(op);
+
+			// nop
+			if (op == 0)
+				continue;
+			// cache, sync
+			else if (opc == 057 || opc == 0 && func == 017)
+				continue;
+			// imm arithmetic
+			else if ((opc & 070) == 010 || (opc & 076) == 030)
+			{
+				if (loads & 1 << rs) {
+					if (!skippable) {
+						loads |= 1 << rt;
+						continue;
+					}
+				}
+				else
+					reads |= 1 << rs;
+				if (skippable)
+					loads &= ~(1 << rt) | 1;
+				if (reads & 1 << rt)
+					return false;
+			}
+			// common register arithmetic instructions
+			else if (opc == 0 && (func & 060) == 040 && (func & 076) != 050)
+			{
+				if (loads & 1 << rs && loads & 1 << rt) {
+					if (!skippable) {
+						loads |= 1 << rd;
+						continue;
+					}
+				}
+				else
+					reads |= 1 << rs | 1 << rt;
+				if (skippable)
+					loads &= ~(1 << rd) | 1;
+				if (reads & 1 << rd)
+					return false;
+			}
+			// loads
+			else if ((opc & 070) == 040 || (opc & 076) == 032 || opc == 067)
+			{
+				if (loads & 1 << rs) {
+					if (!skippable) {
+						loads |= 1 << rt;
+						continue;
+					}
+				}
+				else
+					reads |= 1 << rs;
+				if (skippable)
+					loads &= ~(1 << rt) | 1;
+				if (reads & 1 << rt)
+					return false;
+			}
+			// mfc*, cfc*
+			else if ((opc & 074) == 020 && rs < 4)
+			{
+				if (skippable)
+					loads &= ~(1 << rt) | 1;
+				else
+					loads |= 1 << rt;
+			}
+			// forward branches (out of the loop, or over part of it)
+			else
+			{
+				const R5900::OPCODE& opcode = R5900::GetInstruction(op);
+				const int branchType = opcode.flags & BRANCHTYPE_MASK;
+
+				if (!(opcode.flags & IS_BRANCH) || (opcode.flags & IS_LINKED))
+					return false;
+				if (branchType != BRANCHTYPE_BRANCH && branchType != BRANCHTYPE_BC1)
+					return false;
+
+				const u32 target = addr + 4 + ((signed short)(op&0xFFFF)<<2);
+				if (target >= start && target <= addr)
+					return false;
+
+				// Everything from after the delay slot up to the target may be skipped, and
+				// so may the delay slot of a likely branch, which only runs when it's taken
+				const u32 from = (opcode.flags & IS_LIKELY) ? addr + 4 : addr + 8;
+				const u32 to = target < end ? target : addr + 8;
+				if (to > from) {
+					if (skipEnd <= from)
+						skipFrom = from;
+					skipEnd = std::max(skipEnd, to);
+				}
+
+				if (branchType == BRANCHTYPE_BRANCH)
+					reads |= 1 << rs | 1 << rt;
+			}
+		}
+
+		return true;
+	}
 }
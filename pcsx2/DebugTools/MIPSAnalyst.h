@@ -72,4 +72,12 @@ namespace MIPSAnalyst
 	} MipsOpcodeInfo;
 	
 	MipsOpcodeInfo GetOpcodeInfo(DebugInterface* cpu, u32 address);
+
+	// Largest loop (in bytes) the EE recompiler checks when the loop spans several blocks.
+	static const u32 IdleLoopMaxSize = 32 * 4;
+
+	// Returns true if the loop [start, end) (end being past the delay slot of the branch
+	// back to start) does the same thing on every iteration until something else changes
+	// the memory it reads.
+	bool IsIdleLoop(u32 start, u32 end);
 };
@@ -0,0 +1,175 @@
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2002-2010  PCSX2 Dev Team
+ *
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+// --------------------------------------------------------------------------------------
+//  EventQueue
+// --------------------------------------------------------------------------------------
+// Min-heap of the pending timed events of a cpu (CPU_INT / PSX_INT slots), keyed by the
+// absolute cycle they are due at, so that the event test only looks at the events that
+// are actually due and the next event cycle comes straight from the head of the heap.
+//
+// The cpu regs (interrupt, sCycle, eCycle) remain the authoritative state, since that's
+// what savestates hold and what the DMA code pokes at directly.  The heap is validated
+// against them lazily: an entry whose interrupt bit has been cleared is dropped when it
+// reaches the head, and one whose delta was lengthened in place (IPU1's 0x9999 wait) is
+// requeued at its new cycle.  Shortening a delta in place would go unnoticed until the old
+// cycle is reached, so always go through CPU_INT / PSX_INT for that.
+//
+template< uint Slots >
+class EventQueue
+{
+	static_assert( Slots <= 32, "EventQueue slots are tracked in a 32 bit mask" );
+
+protected:
+	struct Entry
+	{
+		u32 due;
+		u32 slot;
+	};
+
+	Entry	m_heap[Slots];
+	s8		m_index[Slots];	// position of each slot in m_heap, or -1 when not queued
+	uint	m_size;
+	u32		m_due;			// slots found due and waiting for their event test
+
+public:
+	EventQueue()
+	{
+		Reset();
+	}
+
+	void Reset()
+	{
+		m_size = 0;
+		m_due = 0;
+		memset( m_index, -1, sizeof(m_index) );
+	}
+
+	// Queues the slot at the given cycle, or moves it there if it's already queued.
+	void Schedule( uint slot, u32 due )
+	{
+		pxAssume( slot < Slots );
+
+		int pos = m_index[slot];
+		if( pos < 0 ) pos = m_size++;
+
+		Place( pos, due, slot );
+		SiftUp( pos );
+		SiftDown( m_index[slot] );
+	}
+
+	bool IsEmpty() const { return m_size == 0; }
+	u32 GetNextDue() const { return m_heap[0].due; }
+
+	// Moves every event due at regs.cycle from the heap to the due mask.
+	template< typename CpuRegs >
+	void CollectDue( const CpuRegs& regs )
+	{
+		while( m_size && (s32)(regs.cycle - m_heap[0].due) >= 0 )
+		{
+			const uint n = m_heap[0].slot;
+			RemoveHead();
+
+			if( !(regs.interrupt & (1 << n)) ) continue;
+
+			const u32 due = regs.sCycle[n] + regs.eCycle[n];
+			if( (s32)(regs.cycle - due) >= 0 )
+				m_due |= 1 << n;
+			else
+				Schedule( n, due );
+		}
+	}
+
+	u32 GetDue() const { return m_due; }
+
+	// Returns true (and forgets it) if the slot was found due.
+	bool TakeDue( uint n )
+	{
+		if( !(m_due & (1 << n)) ) return false;
+		m_due &= ~(1 << n);
+		return true;
+	}
+
+	// Recreates the heap from the cpu regs (reset, savestate load).
+	template< typename CpuRegs >
+	void Rebuild( const CpuRegs& regs )
+	{
+		Reset();
+		for( uint n = 0; n < Slots; ++n )
+		{
+			if( regs.interrupt & (1 << n) )
+				Schedule( n, regs.sCycle[n] + regs.eCycle[n] );
+		}
+	}
+
+protected:
+	static bool IsBefore( u32 a, u32 b )
+	{
+		return (s32)(a - b) < 0;
+	}
+
+	void Place( uint pos, u32 due, uint slot )
+	{
+		m_heap[pos].due = due;
+		m_heap[pos].slot = slot;
+		m_index[slot] = pos;
+	}
+
+	void Swap( uint a, uint b )
+	{
+		const Entry tmp = m_heap[a];
+		Place( a, m_heap[b].due, m_heap[b].slot );
+		Place( b, tmp.due, tmp.slot );
+	}
+
+	void SiftUp( uint pos )
+	{
+		while( pos > 0 )
+		{
+			const uint parent = (pos - 1) / 2;
+			if( !IsBefore( m_heap[pos].due, m_heap[parent].due ) ) break;
+			Swap( pos, parent );
+			pos = parent;
+		}
+	}
+
+	void SiftDown( uint pos )
+	{
+		for(;;)
+		{
+			uint first = pos;
+			const uint left = pos * 2 + 1;
+			const uint right = left + 1;
+
+			if( left < m_size && IsBefore( m_heap[left].due, m_heap[first].due ) ) first = left;
+			if( right < m_size && IsBefore( m_heap[right].due, m_heap[first].due ) ) first = right;
+			if( first == pos ) break;
+
+			Swap( pos, first );
+			pos = first;
+		}
+	}
+
+	void RemoveHead()
+	{
+		m_index[m_heap[0].slot] = -1;
+		if( --m_size == 0 ) return;
+
+		Place( 0, m_heap[m_size].due, m_heap[m_size].slot );
+		SiftDown( 0 );
+	}
+};
@@ -304,6 +304,33 @@ struct MTGS_FreezeData
 	s32			retval;		// value returned from the call, valid only after an mtgsWaitGS()
 };
 
+// --------------------------------------------------------------------------------------
+//  MTGS_Stats
+// --------------------------------------------------------------------------------------
+// MTGS ringbuffer telemetry over the last sampling period (about a second), for tuning
+// the ring size and VsyncQueueSize on a given host.  Times are in milliseconds.
+struct MTGS_Stats
+{
+	static const uint OccupancyBuckets = 8;
+
+	double	Period;
+	double	EEStallTime;		// EE waiting for room in the ringbuffer
+	double	EEVsyncTime;		// EE waiting on the vsync queue (VsyncQueueSize)
+	double	GSIdleTime;			// MTGS thread waiting for work
+	double	SpinTime;			// current (learned) EE spin budget, in microseconds
+
+	uint	Stalls[3];			// ringbuffer stalls that ended spinning, yielding and sleeping
+	uint	Occupancy[OccupancyBuckets];	// ringbuffer fill level at each packet, in 1/8ths of the capacity
+
+	uint	Frames;				// vsyncs sent to the ringbuffer
+	double	QueuedFrames;		// average frames queued ahead of the GS at each vsync
+
+	MTGS_Stats()
+	{
+		memzero( *this );
+	}
+};
+
 // --------------------------------------------------------------------------------------
 //  SysMtgsThread
 // --------------------------------------------------------------------------------------
@@ -348,6 +375,29 @@ public:
 	uint			m_packet_size;		// size of the packet (data only, ie. not including the 16 byte command!)
 	uint			m_packet_writepos;	// index of the data location in the ringbuffer.
 
+	// Usable part of the ringbuffer (see GSOptions::RingSizeFactor), and the shift that
+	// turns a fill level into an occupancy bucket.
+	uint			m_RingCapacity;
+	uint			m_RingBucketShift;
+
+	// Learned EE stall thresholds, in cpu ticks (see GenericStall).
+	u64				m_StallSpinTicks;
+	u64				m_StallYieldTicks;
+
+	// Telemetry counters, see MTGS_Stats.  All of them but the GS idle time are only ever
+	// touched by the EE thread.
+	u64				m_StatStart;
+	u64				m_StatStallTicks;
+	u64				m_StatVsyncTicks;
+	uint			m_StatStalls[3];
+	uint			m_StatOccupancy[MTGS_Stats::OccupancyBuckets];
+	uint			m_StatFrames;
+	uint			m_StatQueuedFrames;
+	std::atomic<u64> m_StatIdleTicks;
+
+	Mutex			m_mtx_Stats;
+	MTGS_Stats		m_Stats;
+
 #ifdef RINGBUF_DEBUG_STACK
 	Threading::Mutex m_lock_Stack;
 #endif
@@ -376,6 +426,7 @@ public:
 	void PostVsyncStart();
 
 	bool IsPluginOpened() const { return m_PluginOpened; }
+	MTGS_Stats GetStats();
 
 protected:
 	void OpenPlugin();
@@ -389,7 +440,13 @@ protected:
 	void OnResumeInThread( bool IsSuspended );
 	void OnCleanupInThread();
 
+	void ApplyRingSize();
 	void GenericStall( uint size );
+	void LearnStall( uint phase, u64 ticks );
+	void ResetStats();
+	void UpdateStats();
+
+	bool HasRoomFor( uint readpos, uint writepos, uint size ) const;
 
 	// Used internally by SendSimplePacket type functions
 	void _FinishSimplePacket();
@@ -460,7 +517,10 @@ extern int g_nLeftGSFrames;
 // (actual size is 1<<m_RingBufferSizeFactor simd vectors [128-bit values])
 // A value of 19 is a 8meg ring buffer.  18 would be 4 megs, and 20 would be 16 megs.
 // Default was 2mb, but some games with lots of MTGS activity want 8mb to run fast (rama)
+// This is the allocated size; GSOptions::RingSizeFactor limits how much of it the EE is
+// allowed to fill, down to RingBufferSizeFactorMin.
 static const uint RingBufferSizeFactor = 19;
+static const uint RingBufferSizeFactorMin = 12;
 
 // size of the ringbuffer in simd128's.
 static const uint RingBufferSize = 1<<RingBufferSizeFactor;
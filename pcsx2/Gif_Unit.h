@@ -148,6 +148,10 @@ struct GS_FINISH {
 	void Reset() { memzero(*this); }
 };
 
+// Path 3 image primitives at least this big are passed on to the MTGS as their data
+// arrives, instead of being accumulated in the path buffer until they're complete.
+static const u32 GIF_IMAGE_STREAM_MIN = _64kb;
+
 static __fi void incTag(u32& offset, u32& size, u32 incAmount) {
 	size   += incAmount;
 	offset += incAmount;
@@ -211,6 +215,7 @@ struct Gif_Path {
 	}
 
 	bool isMTVU() const           { return !idx && THREAD_VU1; }
+	bool isStreamingImage() const { return gifTag.isValid && gifTag.tag.FLG == GIF_FLG_IMAGE; }
 	s32 getReadAmount()           { return readAmount.load(std::memory_order_acquire) + gsPack.readAmount; }
 	bool hasDataRemaining() const { return curOffset < curSize; }
 	bool isDone() const           { return isMTVU() ? !mtvu.fakePackets : (!hasDataRemaining() && (state == GIF_PATH_IDLE || state == GIF_PATH_WAIT)); }
@@ -294,7 +299,7 @@ struct Gif_Path {
 				state = (GIF_PATH_STATE)(gifTag.tag.FLG + 1);
 
 				// We don't have enough data for a complete GS packet
-				if(!gifTag.hasAD && curOffset + 16 + gifTag.len > curSize) {
+				if(!gifTag.hasAD && curOffset + 16 + gifTag.len > curSize && !canStreamImage()) {
 					gifTag.isValid = false; // So next time we test again
 					return gsPack;
 				}
@@ -315,6 +320,12 @@ struct Gif_Path {
 				}
 				if (dblSIGNAL && !(gifTag.tag.EOP && !gifTag.nLoop)) return gsPack; // Exit Early
 			}
+			else if (curOffset + gifTag.len > curSize) { // Streamed image, see canStreamImage()
+				u32 avail = curSize - curOffset;
+				gifTag.len -= avail;
+				incTag(curOffset, gsPack.size, avail);
+				return gsPack;
+			}
 			else incTag(curOffset, gsPack.size, gifTag.len); // Data length
 
 			// Reload gif tag next loop
@@ -351,6 +362,16 @@ struct Gif_Path {
 		}
 	}
 
+	// Big path 3 texture uploads usually have their image data in a separate dma tag from
+	// the gif tag, often spanning several megabytes.  Instead of holding the whole primitive
+	// back (and moving it around the path buffer on realigns), the data is handed to the
+	// MTGS as it arrives, the same way the GS takes it.  The remaining length is kept in
+	// gifTag.len.  Not done with IMT set, since path 3 slicing restarts at the image tag.
+	bool canStreamImage() const {
+		return idx == GIF_PATH_3 && gifTag.tag.FLG == GIF_FLG_IMAGE
+			&& gifTag.len >= GIF_IMAGE_STREAM_MIN && !gifRegs.stat.IMT;
+	}
+
 	// MTVU: Gets called on VU XGkicks on MTVU thread
 	void ExecuteGSPacketMTVU() {
 		// Move packet to start of buffer
@@ -560,7 +581,7 @@ struct Gif_Unit {
 	void FlushToMTGS() {
 		if (!stat.APATH) return;
 		Gif_Path& path = gifPath[stat.APATH-1];
-		if (path.gsPack.size && !path.gifTag.isValid) {
+		if (path.gsPack.size && (!path.gifTag.isValid || path.isStreamingImage())) {
 			AddCompletedGSPacket(path.gsPack, (GIF_PATH)(stat.APATH-1));
 			path.gsPack.offset = path.curOffset;
 			path.gsPack.size   = 0;
@@ -672,7 +693,7 @@ struct Gif_Unit {
 		return((stat.APATH == 0 && !Path3Masked()) || stat.APATH == 3) && CanDoGif();
 	}
 
-	bool CanDoP3Slice()const { return stat.IMT == 1 && gifPath[GIF_PATH_3].state == GIF_PATH_IMAGE; }
+	bool CanDoP3Slice()const { return stat.IMT == 1 && gifPath[GIF_PATH_3].state == GIF_PATH_IMAGE && !gifPath[GIF_PATH_3].isStreamingImage(); }
 	bool CanDoGif() const    { return stat.PSE == 0 && stat.DIR == 0 && gsSIGNAL.queued == 0; }
 	//Mask stops the next packet which hasnt started from transferring
 	bool Path3Masked() const { return ((stat.M3R || stat.M3P) && (gifPath[GIF_PATH_3].state == GIF_PATH_IDLE || gifPath[GIF_PATH_3].state == GIF_PATH_WAIT)); }
@@ -22,6 +22,7 @@
 #include "ps2/eeHwTraceLog.inl"
 
 #include "ps2/pgif.h"
+#include "MTIOP.h"
 
 using namespace R5900;
 
@@ -33,6 +34,35 @@ static __fi void IntCHackCheck()
 	if( diff > 0 ) cpuRegs.cycle = g_nextEventCycle;
 }
 
+HwPollState hwPoll;
+
+static const uint HwPollRepeats   = 3;		// identical reads before fast-forwarding
+static const u32  HwPollMaxCycles = 256;	// EE cycles between two reads of the same loop
+
+void hwPollCheck(u32 mem, u32 value)
+{
+	const u32 delta = cpuRegs.cycle - hwPoll.cycle;
+
+	// Note: the recompilers don't flush the pc before memory accesses, but it holds the
+	// start of the block, which is just as good to tell loops apart.
+	if (mem != hwPoll.mem || value != hwPoll.value || cpuRegs.pc != hwPoll.pc || delta > HwPollMaxCycles)
+	{
+		hwPoll.mem		= mem;
+		hwPoll.pc		= cpuRegs.pc;
+		hwPoll.value	= value;
+		hwPoll.cycle	= cpuRegs.cycle;
+		hwPoll.count	= 0;
+		return;
+	}
+
+	if (hwPoll.count < HwPollRepeats)
+		++hwPoll.count;
+	else
+		IntCHackCheck();
+
+	hwPoll.cycle = cpuRegs.cycle;
+}
+
 template< uint page > void __fastcall _hwRead128(u32 mem, mem128_t* result );
 
 template< uint page, bool intcstathack >
@@ -90,6 +120,9 @@ mem32_t __fastcall _hwRead32(u32 mem)
 				return psHu32(INTC_STAT);
 			}
 
+			// SBUS registers are shared with the IOP
+			iopThread.Wait();
+
 			// todo: psx mode: this is new
 			if (((mem & 0x1FFFFFFF) >= EEMemoryMap::SBUS_PS1_Start) && ((mem & 0x1FFFFFFF) < EEMemoryMap::SBUS_PS1_End)) {
 				return PGIFr((mem & 0x1FFFFFFF));
@@ -211,6 +244,7 @@ mem32_t __fastcall hwRead32(u32 mem)
 {
 	mem32_t retval = _hwRead32<page,false>(mem);
 	eeHwTraceLog( mem, retval, true );
+	if (hwPollPage(page) && EmuConfig.Speedhacks.hwPoll) hwPollCheck(mem, retval);
 	return retval;
 }
 
@@ -254,6 +288,7 @@ mem16_t __fastcall hwRead16(u32 mem)
 {
 	u16 ret16 = _hwRead16<page>(mem);
 	eeHwTraceLog( mem, ret16, true );
+	if (hwPollPage(page) && EmuConfig.Speedhacks.hwPoll) hwPollCheck(mem, ret16);
 	return ret16;
 }
 
@@ -24,6 +24,7 @@
 
 #include "ps2/pgif.h"
 #include "R3000A.h"
+#include "MTIOP.h"
 
 using namespace R5900;
 
@@ -138,6 +139,9 @@ void __fastcall _hwWrite32( u32 mem, u32 value )
 
 		case 0x0f:
 		{
+			// SBUS registers are shared with the IOP
+			if (mem != INTC_STAT && mem != INTC_MASK) iopThread.Wait();
+
 			switch( HELPSWITCH(mem) )
 			{
 				mcase(INTC_STAT):
@@ -269,6 +273,7 @@ void __fastcall _hwWrite32( u32 mem, u32 value )
 template<uint page>
 void __fastcall hwWrite32( u32 mem, u32 value )
 {
+	hwPollBreak();
 	eeHwTraceLog( mem, value, false );
 	_hwWrite32<page>( mem, value );
 }
@@ -330,6 +335,7 @@ void __fastcall _hwWrite8(u32 mem, u8 value)
 template< uint page >
 void __fastcall hwWrite8(u32 mem, u8 value)
 {
+	hwPollBreak();
 	eeHwTraceLog( mem, value, false );
 	_hwWrite8<page>(mem, value);
 }
@@ -361,6 +367,7 @@ void __fastcall _hwWrite16(u32 mem, u16 value)
 template< uint page >
 void __fastcall hwWrite16(u32 mem, u16 value)
 {
+	hwPollBreak();
 	eeHwTraceLog( mem, value, false );
 	_hwWrite16<page>(mem, value);
 }
@@ -409,6 +416,7 @@ void __fastcall _hwWrite64( u32 mem, const mem64_t* srcval )
 template<uint page>
 void __fastcall hwWrite64( u32 mem, const mem64_t* srcval )
 {
+	hwPollBreak();
 	eeHwTraceLog( mem, *srcval, false );
 	_hwWrite64<page>(mem, srcval);
 }
@@ -473,6 +481,7 @@ void __fastcall _hwWrite128(u32 mem, const mem128_t* srcval)
 template< uint page >
 void __fastcall hwWrite128(u32 mem, const mem128_t* srcval)
 {
+	hwPollBreak();
 	eeHwTraceLog( mem, *srcval, false );
 	_hwWrite128<page>(mem, srcval);
 }
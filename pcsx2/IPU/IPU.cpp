@@ -18,6 +18,7 @@
 
 #include "IPU.h"
 #include "IPUdma.h"
+#include "IPU_Thread.h"
 #include "yuv2rgb.h"
 #include "mpeg2lib/Mpeg.h"
 
@@ -60,7 +61,9 @@ void tIPU_cmd::clear()
 	current = 0xffffffff;
 }
 
-__fi void IPUProcessInterrupt()
+// Runs the current command for as long as there is input and output space for it.
+// Called from the IPU thread when it is enabled, from the EE thread otherwise.
+void ipuProcessCommand()
 {
 	if (ipuRegs.ctrl.BUSY) // && (g_BP.FP || g_BP.IFC || (ipu1ch.chcr.STR && ipu1ch.qwc > 0)))
 		IPUWorker();
@@ -73,11 +76,31 @@ __fi void IPUProcessInterrupt()
 	}
 }
 
+__fi void IPUProcessInterrupt()
+{
+	if (THREAD_IPU)
+	{
+		if (ipuRegs.ctrl.BUSY) ipuThread.Kick();
+		return;
+	}
+
+	ipuProcessCommand();
+}
+
+// Signals the end of a command; IPUWorker may be running on the IPU thread.
+static __fi void ipuIntcIrq()
+{
+	if (ipuThread.IsSelf()) ipuThread.PostEvent(IPU_EVENT_INTC);
+	else hwIntcIrq(INTC_IPU);
+}
+
 /////////////////////////////////////////////////////////
 // Register accesses (run on EE thread)
 
 void ipuReset()
 {
+	ipuThread.Wait();
+
 	memzero(ipuRegs);
 	memzero(g_BP);
 	memzero(decoder);
@@ -107,6 +130,8 @@ void SaveStateBase::ipuFreeze()
 {
 	// Get a report of the status of the ipu variables when saving and loading savestates.
 	//ReportIPU();
+	ipuThread.Wait();
+
 	FreezeTag("IPU");
 	Freeze(ipu_fifo);
 
@@ -201,7 +226,10 @@ __fi u32 ipuRead32(u32 mem)
 	pxAssert((mem & ~0xff) == 0x10002000);
 	mem &= 0xff;	// ipu repeats every 0x100
 
-	IPUProcessInterrupt();
+	// The IPU thread is kicked by every FIFO and command change, so there's nothing new
+	// for it to do here; just wait for the result.
+	ipuThread.Wait();
+	if (!THREAD_IPU) IPUProcessInterrupt();
 
 	switch (mem)
 	{
@@ -243,7 +271,10 @@ __fi u64 ipuRead64(u32 mem)
 	pxAssert((mem & ~0xff) == 0x10002000);
 	mem &= 0xff;	// ipu repeats every 0x100
 
-	IPUProcessInterrupt();
+	// The IPU thread is kicked by every FIFO and command change, so there's nothing new
+	// for it to do here; just wait for the result.
+	ipuThread.Wait();
+	if (!THREAD_IPU) IPUProcessInterrupt();
 
 	switch (mem)
 	{
@@ -294,6 +325,8 @@ __fi bool ipuWrite32(u32 mem, u32 value)
 	pxAssert((mem & ~0xfff) == 0x10002000);
 	mem &= 0xfff;
 
+	ipuThread.Wait();
+
 	switch (mem)
 	{
 		ipucase(IPU_CMD): // IPU_CMD
@@ -330,6 +363,8 @@ __fi bool ipuWrite64(u32 mem, u64 value)
 	pxAssert((mem & ~0xfff) == 0x10002000);
 	mem &= 0xfff;
 
+	ipuThread.Wait();
+
 	switch (mem)
 	{
 		ipucase(IPU_CMD):
@@ -407,7 +442,7 @@ static __ri void ipuBDEC(tIPU_CMD_BDEC bdec)
 	memzero_sse_a(decoder.mb16);
 }
 
-static __fi bool ipuVDEC(u32 val)
+static void ipuDetectFMV()
 {
 	if (EmuConfig.Gamefixes.FMVinSoftwareHack || g_Conf->GSWindow.FMVAspectRatioSwitch != FMV_AspectRatio_Switch_Off) {
 		static int count = 0;
@@ -420,6 +455,10 @@ static __fi bool ipuVDEC(u32 val)
 		}
 		eecount_on_last_vdec = cpuRegs.cycle;
 	}
+}
+
+static __fi bool ipuVDEC(u32 val)
+{
 	switch (ipu_cmd.pos[0])
 	{
 		case 0:
@@ -679,6 +718,32 @@ __fi void ipu_csc(macroblock_8& mb8, macroblock_rgb32& rgb32, int sgn)
 
 __fi void ipu_dither(const macroblock_rgb32& rgb32, macroblock_rgb16& rgb16, int dte)
 {
+#if defined(__AVX2__)
+	const __m256i mask_r = _mm256_set1_epi32(0x1f);
+	const __m256i mask_g = _mm256_set1_epi32(0x1f << 5);
+	const __m256i mask_b = _mm256_set1_epi32(0x1f << 10);
+	const __m256i alpha_ref = _mm256_set1_epi32(0x40);
+	const __m256i alpha_bit = _mm256_set1_epi32(0x8000);
+
+	const __m256i* src = (const __m256i*)&rgb32;
+	__m256i* dst = (__m256i*)&rgb16;
+
+	// 16 pixels per iteration
+	for (int i = 0; i < 16; ++i)
+	{
+		__m256i c[2];
+		for (int j = 0; j < 2; ++j)
+		{
+			__m256i p = _mm256_loadu_si256(src + i * 2 + j);
+			__m256i r = _mm256_and_si256(_mm256_srli_epi32(p, 3), mask_r);
+			__m256i g = _mm256_and_si256(_mm256_srli_epi32(p, 6), mask_g);
+			__m256i b = _mm256_and_si256(_mm256_srli_epi32(p, 9), mask_b);
+			__m256i a = _mm256_and_si256(_mm256_cmpeq_epi32(_mm256_srli_epi32(p, 24), alpha_ref), alpha_bit);
+			c[j] = _mm256_or_si256(_mm256_or_si256(r, g), _mm256_or_si256(b, a));
+		}
+		_mm256_storeu_si256(dst + i, _mm256_permute4x64_epi64(_mm256_packus_epi32(c[0], c[1]), _MM_SHUFFLE(3, 1, 2, 0)));
+	}
+#else
 	int i, j;
 	for (i = 0; i < 16; ++i)
 	{
@@ -690,11 +755,88 @@ __fi void ipu_dither(const macroblock_rgb32& rgb32, macroblock_rgb16& rgb16, int
 			rgb16.c[i][j].a = rgb32.c[i][j].a == 0x40;
 		}
 	}
+#endif
+}
+
+#if !defined(__AVX2__)
+// VQCLUT entries use the rgb16_t layout (r in the low bits).  The first of equally close
+// entries wins.
+static __fi u8 ipu_vq_closest(const rgb16_t& c)
+{
+	u8 index = 0;
+	int min_distance = INT_MAX;
+
+	for (int k = 0; k < 16; ++k)
+	{
+		const int dr = c.r - (vqclut[k] & 0x1f);
+		const int dg = c.g - ((vqclut[k] >> 5) & 0x1f);
+		const int db = c.b - ((vqclut[k] >> 10) & 0x1f);
+		const int distance = dr * dr + dg * dg + db * db;
+
+		if (distance < min_distance)
+		{
+			index = k;
+			min_distance = distance;
+		}
+	}
+
+	return index;
 }
+#endif
 
+// INDX4 output: the closest VQCLUT index of each pixel, the first pixel of a pair in the
+// low nibble.
 __fi void ipu_vq(macroblock_rgb16& rgb16, u8* indx4)
 {
-	Console.Error("IPU: VQ not implemented");
+#if defined(__AVX2__)
+	const __m256i mask5 = _mm256_set1_epi16(0x1f);
+	const __m256i low_bytes = _mm256_setr_epi8(
+		0, 4, 8, 12, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+		0, 4, 8, 12, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1);
+
+	__m256i clut_r[16], clut_g[16], clut_b[16];
+	for (int k = 0; k < 16; ++k)
+	{
+		clut_r[k] = _mm256_set1_epi16(vqclut[k] & 0x1f);
+		clut_g[k] = _mm256_set1_epi16((vqclut[k] >> 5) & 0x1f);
+		clut_b[k] = _mm256_set1_epi16((vqclut[k] >> 10) & 0x1f);
+	}
+
+	// one row of 16 pixels per iteration, distances fit in 16 bits (3 * 31 * 31)
+	for (int i = 0; i < 16; ++i)
+	{
+		__m256i p = _mm256_loadu_si256((__m256i*)&rgb16.c[i][0]);
+		__m256i r = _mm256_and_si256(p, mask5);
+		__m256i g = _mm256_and_si256(_mm256_srli_epi16(p, 5), mask5);
+		__m256i b = _mm256_and_si256(_mm256_srli_epi16(p, 10), mask5);
+
+		__m256i min_distance = _mm256_set1_epi16(0x7fff);
+		__m256i index = _mm256_setzero_si256();
+
+		for (int k = 0; k < 16; ++k)
+		{
+			__m256i dr = _mm256_sub_epi16(r, clut_r[k]);
+			__m256i dg = _mm256_sub_epi16(g, clut_g[k]);
+			__m256i db = _mm256_sub_epi16(b, clut_b[k]);
+			__m256i distance = _mm256_add_epi16(_mm256_add_epi16(_mm256_mullo_epi16(dr, dr), _mm256_mullo_epi16(dg, dg)), _mm256_mullo_epi16(db, db));
+
+			__m256i closer = _mm256_cmpgt_epi16(min_distance, distance);
+			min_distance = _mm256_min_epi16(min_distance, distance);
+			index = _mm256_blendv_epi8(index, _mm256_set1_epi16(k), closer);
+		}
+
+		// Pixel pairs share a 32-bit lane, fold the odd index into the high nibble of the
+		// low byte, then gather the low bytes.
+		index = _mm256_or_si256(index, _mm256_srli_epi32(index, 12));
+		index = _mm256_shuffle_epi8(index, low_bytes);
+		index = _mm256_permutevar8x32_epi32(index, _mm256_setr_epi32(0, 4, 1, 1, 1, 1, 1, 1));
+		_mm_storel_epi64((__m128i*)(indx4 + i * 8), _mm256_castsi256_si128(index));
+	}
+#else
+	for (int i = 0; i < 16; ++i)
+		for (int j = 0; j < 8; ++j)
+			indx4[i * 8 + j] = (ipu_vq_closest(rgb16.c[i][j * 2 + 1]) << 4) | ipu_vq_closest(rgb16.c[i][j * 2]);
+#endif
 }
 
 
@@ -869,6 +1011,7 @@ __fi void IPUCMD_WRITE(u32 val)
 			break;
 
 		case SCE_IPU_VDEC:
+			ipuDetectFMV();
 			g_BP.Advance(val & 0x3F);
 			ipuRegs.SetDataBusy();
 			break;
@@ -972,5 +1115,5 @@ __noinline void IPUWorker()
 	// success
 	ipuRegs.ctrl.BUSY = 0;
 	ipu_cmd.current = 0xffffffff;
-	hwIntcIrq(INTC_IPU);
+	ipuIntcIrq();
 }
@@ -17,6 +17,7 @@
 #include "Common.h"
 #include "IPU.h"
 #include "IPU/IPUdma.h"
+#include "IPU/IPU_Thread.h"
 #include "mpeg2lib/Mpeg.h"
 
 __aligned16 IPU_Fifo ipu_fifo;
@@ -88,7 +89,11 @@ int IPU_Fifo_Input::read(void *value)
 	if (g_BP.IFC < 3)
 	{
 		// IPU FIFO is empty and DMA is waiting so lets tell the DMA we are ready to put data in the FIFO
-		if(cpuRegs.eCycle[4] == 0x9999)
+		if (ipuThread.IsSelf())
+		{
+			ipuThread.PostEvent(IPU_EVENT_REFILL);
+		}
+		else if(cpuRegs.eCycle[4] == 0x9999)
 		{
 			CPU_INT( DMAC_TO_IPU, 32 );
 		}
@@ -161,19 +166,26 @@ void IPU_Fifo_Output::read(void *value, uint size)
 
 void __fastcall ReadFIFO_IPUout(mem128_t* out)
 {
+	ipuThread.Wait();
+
 	if (!pxAssertDev( ipuRegs.ctrl.OFC > 0, "Attempted read from IPUout's FIFO, but the FIFO is empty!" )) return;
 	ipu_fifo.out.read(out, 1);
 
 	// Games should always check the fifo before reading from it -- so if the FIFO has no data
 	// its either some glitchy game or a bug in pcsx2.
+
+	// Register reads don't kick the IPU thread, so let it know about the freed space here.
+	if (THREAD_IPU) IPUProcessInterrupt();
 }
 
 void __fastcall WriteFIFO_IPUin(const mem128_t* value)
 {
 	IPU_LOG( "WriteFIFO/IPUin <- %ls", WX_STR(value->ToString()) );
 
+	ipuThread.Wait();
+
 	//committing every 16 bytes
-	if( ipu_fifo.in.write((u32*)value, 1) == 0 )
+	if( ipu_fifo.in.write((u32*)value, 1) == 0 || THREAD_IPU )
 	{
 		IPUProcessInterrupt();
 	}
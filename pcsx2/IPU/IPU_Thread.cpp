@@ -0,0 +1,94 @@
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2002-2010  PCSX2 Dev Team
+ *
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "PrecompiledHeader.h"
+#include "Common.h"
+#include "IPU.h"
+#include "IPU_Thread.h"
+
+IPU_Thread ipuThread;
+
+IPU_Thread::IPU_Thread()
+{
+	m_name = L"MTIPU";
+	m_kicked = 0;
+	m_processed = 0;
+	m_events = 0;
+}
+
+IPU_Thread::~IPU_Thread()
+{
+	try {
+		pxThread::Cancel();
+	}
+	DESTRUCTOR_CATCHALL
+}
+
+void IPU_Thread::ExecuteTaskInThread()
+{
+	for(;;) {
+		semaEvent.WaitWithoutYield();
+		ScopedLock lock(mtxBusy);
+
+		u32 kicked = m_kicked.load(std::memory_order_acquire);
+		if (kicked == m_processed.load(std::memory_order_relaxed)) continue;
+
+		ipuProcessCommand();
+		m_processed.store(kicked, std::memory_order_release);
+	}
+}
+
+void IPU_Thread::Kick()
+{
+	pxAssert(IsDone());
+	if (!IsRunning()) Start();
+
+	m_kicked.store(m_kicked.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+	semaEvent.Post();
+}
+
+bool IPU_Thread::IsDone()
+{
+	return m_processed.load(std::memory_order_acquire) == m_kicked.load(std::memory_order_relaxed);
+}
+
+void IPU_Thread::Wait()
+{
+	for(;;) {
+		if (IsDone()) break;
+		std::this_thread::yield(); // Give a chance to the IPU thread to actually start
+		ScopedLock lock(mtxBusy);
+	}
+	DeliverEvents();
+}
+
+void IPU_Thread::PostEvent(IPU_EVENT ev)
+{
+	m_events.fetch_or(ev, std::memory_order_relaxed);
+}
+
+void IPU_Thread::DeliverEvents()
+{
+	if (!m_events.load(std::memory_order_relaxed)) return;
+
+	u32 events = m_events.exchange(0);
+
+	// IPU1 is waiting for space in the input FIFO
+	if ((events & IPU_EVENT_REFILL) && cpuRegs.eCycle[4] == 0x9999)
+		CPU_INT(DMAC_TO_IPU, 32);
+
+	if (events & IPU_EVENT_INTC)
+		hwIntcIrq(INTC_IPU);
+}
@@ -0,0 +1,65 @@
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2002-2010  PCSX2 Dev Team
+ *
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+#include "System/SysThreads.h"
+
+// Events raised by IPUWorker that have to be acted upon by the EE thread.
+enum IPU_EVENT {
+	IPU_EVENT_INTC   = 1 << 0, // Command completed, raise INTC_IPU
+	IPU_EVENT_REFILL = 1 << 1, // Input FIFO ran low while IPU1 was waiting for space
+};
+
+// Notes:
+// - Runs IPUWorker (macroblock decoding, CSC, PACK...) on its own thread when the
+//   ipuThread speedhack is enabled.
+// - The EE hands work over with Kick() after it has fed the input FIFO, drained the output
+//   FIFO or written a command, then carries on.  Every EE side access to the IPU state
+//   (registers, FIFOs, DMA, savestates) calls Wait() first, so the EE only stalls when the
+//   decode it is about to look at hasn't finished yet, and it always sees the same state
+//   it would have seen with the inline worker.
+// - Interrupts raised by the worker are posted as IPU_EVENTs and delivered on the EE
+//   thread by Wait() or the EE event test.
+class IPU_Thread : public pxThread {
+	__aligned(64) std::atomic<u32> m_kicked;    // Only modified by EE thread
+	__aligned(64) std::atomic<u32> m_processed; // Only modified by IPU thread
+	__aligned(64) std::atomic<u32> m_events;
+	Mutex     mtxBusy;
+	Semaphore semaEvent;
+
+public:
+	IPU_Thread();
+	virtual ~IPU_Thread();
+
+	// Starts the thread if needed, and gets it to process the current command.
+	void Kick();
+
+	// Used for assertions...
+	bool IsDone();
+
+	// Waits till the IPU thread is done processing, then delivers its events.
+	void Wait();
+
+	// Called by the IPU thread
+	void PostEvent(IPU_EVENT ev);
+
+	// Called by the EE thread
+	void DeliverEvents();
+
+protected:
+	void ExecuteTaskInThread();
+};
+
+extern IPU_Thread ipuThread;
@@ -17,6 +17,7 @@
 #include "Common.h"
 #include "IPU.h"
 #include "IPU/IPUdma.h"
+#include "IPU/IPU_Thread.h"
 #include "mpeg2lib/Mpeg.h"
 
 #include "Vif.h"
@@ -112,6 +113,8 @@ int IPU1dma()
 	int ipu1cycles = 0;
 	int totalqwc = 0;
 
+	ipuThread.Wait();
+
 	//We need to make sure GIF has flushed before sending IPU data, it seems to REALLY screw FFX videos
 
 	if(!ipu1ch.chcr.STR || IPU1Status.DMAMode == 2)
@@ -194,6 +197,9 @@ int IPU1dma()
 
 void IPU0dma()
 {
+	// Stalls the EE only if the IPU thread is still producing the output.
+	ipuThread.Wait();
+
 	if(!ipuRegs.ctrl.OFC) 
 	{
 		IPU_INT_FROM( 64 );
@@ -253,7 +259,7 @@ void IPU0dma()
 		//Note that interrupting based on totalsize is just guessing..
 	
 	IPU_INT_FROM( readsize * BIAS );
-	if(ipuRegs.ctrl.IFC > 0) IPUProcessInterrupt();
+	if(ipuRegs.ctrl.IFC > 0 || THREAD_IPU) IPUProcessInterrupt();
 
 	//return readsize;
 }
@@ -155,8 +155,149 @@ static __fi void idct_col (s16 * const block)
     block[8*7] = (a0 - b0) >> 17;
 }
 
+#if defined(__AVX2__)
+// Same arithmetic as idct_row/idct_col with the 8 rows (or columns) of a block in the
+// 32-bit lanes of a register, so the results are identical to the C version.  The row
+// shortcut isn't needed: for a DC only row the full pass gives the same result.
+
+static __fi void transpose8x8_epi32(__m256i (&r)[8])
+{
+	__m256i t0 = _mm256_unpacklo_epi32(r[0], r[1]);
+	__m256i t1 = _mm256_unpackhi_epi32(r[0], r[1]);
+	__m256i t2 = _mm256_unpacklo_epi32(r[2], r[3]);
+	__m256i t3 = _mm256_unpackhi_epi32(r[2], r[3]);
+	__m256i t4 = _mm256_unpacklo_epi32(r[4], r[5]);
+	__m256i t5 = _mm256_unpackhi_epi32(r[4], r[5]);
+	__m256i t6 = _mm256_unpacklo_epi32(r[6], r[7]);
+	__m256i t7 = _mm256_unpackhi_epi32(r[6], r[7]);
+
+	__m256i u0 = _mm256_unpacklo_epi64(t0, t2);
+	__m256i u1 = _mm256_unpackhi_epi64(t0, t2);
+	__m256i u2 = _mm256_unpacklo_epi64(t1, t3);
+	__m256i u3 = _mm256_unpackhi_epi64(t1, t3);
+	__m256i u4 = _mm256_unpacklo_epi64(t4, t6);
+	__m256i u5 = _mm256_unpackhi_epi64(t4, t6);
+	__m256i u6 = _mm256_unpacklo_epi64(t5, t7);
+	__m256i u7 = _mm256_unpackhi_epi64(t5, t7);
+
+	r[0] = _mm256_permute2x128_si256(u0, u4, 0x20);
+	r[1] = _mm256_permute2x128_si256(u1, u5, 0x20);
+	r[2] = _mm256_permute2x128_si256(u2, u6, 0x20);
+	r[3] = _mm256_permute2x128_si256(u3, u7, 0x20);
+	r[4] = _mm256_permute2x128_si256(u0, u4, 0x31);
+	r[5] = _mm256_permute2x128_si256(u1, u5, 0x31);
+	r[6] = _mm256_permute2x128_si256(u2, u6, 0x31);
+	r[7] = _mm256_permute2x128_si256(u3, u7, 0x31);
+}
+
+static __fi void BUTTERFLY_AVX2(__m256i& t0, __m256i& t1, int w0, int w1, __m256i d0, __m256i d1)
+{
+	__m256i tmp = _mm256_mullo_epi32(_mm256_set1_epi32(w0), _mm256_add_epi32(d0, d1));
+	t0 = _mm256_add_epi32(tmp, _mm256_mullo_epi32(_mm256_set1_epi32(w1 - w0), d1));
+	t1 = _mm256_sub_epi32(tmp, _mm256_mullo_epi32(_mm256_set1_epi32(w1 + w0), d0));
+}
+
+// Stores to a s16 block truncate, keep doing that between the passes.
+static __fi __m256i truncate_epi16(__m256i x)
+{
+	return _mm256_srai_epi32(_mm256_slli_epi32(x, 16), 16);
+}
+
+// d[n] holds coefficient n of each row (row pass) or of each column (column pass).
+template< bool col >
+static __fi void idct_pass_avx2(__m256i (&d)[8])
+{
+	__m256i a0, a1, a2, a3, b0, b1, b2, b3;
+	__m256i t0, t1, t2, t3;
+
+	__m256i d0 = _mm256_add_epi32(_mm256_slli_epi32(d[0], 11), _mm256_set1_epi32(col ? 65536 : 128));
+	__m256i d2 = _mm256_slli_epi32(d[2], 11);
+	t0 = _mm256_add_epi32(d0, d2);
+	t1 = _mm256_sub_epi32(d0, d2);
+	BUTTERFLY_AVX2(t2, t3, W6, W2, d[3], d[1]);
+	a0 = _mm256_add_epi32(t0, t2);
+	a1 = _mm256_add_epi32(t1, t3);
+	a2 = _mm256_sub_epi32(t1, t3);
+	a3 = _mm256_sub_epi32(t0, t2);
+
+	BUTTERFLY_AVX2(t0, t1, W7, W1, d[7], d[4]);
+	BUTTERFLY_AVX2(t2, t3, W3, W5, d[5], d[6]);
+	b0 = _mm256_add_epi32(t0, t2);
+	b3 = _mm256_add_epi32(t1, t3);
+	t0 = _mm256_sub_epi32(t0, t2);
+	t1 = _mm256_sub_epi32(t1, t3);
+
+	const __m256i c181 = _mm256_set1_epi32(181);
+	if (col)
+	{
+		t0 = _mm256_srai_epi32(t0, 8);
+		t1 = _mm256_srai_epi32(t1, 8);
+		b1 = _mm256_mullo_epi32(_mm256_add_epi32(t0, t1), c181);
+		b2 = _mm256_mullo_epi32(_mm256_sub_epi32(t0, t1), c181);
+	}
+	else
+	{
+		b1 = _mm256_srai_epi32(_mm256_mullo_epi32(_mm256_add_epi32(t0, t1), c181), 8);
+		b2 = _mm256_srai_epi32(_mm256_mullo_epi32(_mm256_sub_epi32(t0, t1), c181), 8);
+	}
+
+	const int shift = col ? 17 : 8;
+	d[0] = truncate_epi16(_mm256_srai_epi32(_mm256_add_epi32(a0, b0), shift));
+	d[1] = truncate_epi16(_mm256_srai_epi32(_mm256_add_epi32(a1, b1), shift));
+	d[2] = truncate_epi16(_mm256_srai_epi32(_mm256_add_epi32(a2, b2), shift));
+	d[3] = truncate_epi16(_mm256_srai_epi32(_mm256_add_epi32(a3, b3), shift));
+	d[4] = truncate_epi16(_mm256_srai_epi32(_mm256_sub_epi32(a3, b3), shift));
+	d[5] = truncate_epi16(_mm256_srai_epi32(_mm256_sub_epi32(a2, b2), shift));
+	d[6] = truncate_epi16(_mm256_srai_epi32(_mm256_sub_epi32(a1, b1), shift));
+	d[7] = truncate_epi16(_mm256_srai_epi32(_mm256_sub_epi32(a0, b0), shift));
+}
+
+// Leaves the 8 output rows of the block in r, and clears the block.
+static __fi void idct_avx2(s16 * const block, __m256i (&r)[8])
+{
+	for (int i = 0; i < 8; i++)
+		r[i] = _mm256_cvtepi16_epi32(_mm_load_si128((__m128i*)(block + 8 * i)));
+
+	transpose8x8_epi32(r);
+	idct_pass_avx2<false>(r);
+	transpose8x8_epi32(r);
+	idct_pass_avx2<true>(r);
+
+	const __m256i zero = _mm256_setzero_si256();
+	for (int i = 0; i < 4; i++)
+		_mm256_storeu_si256((__m256i*)(block + 16 * i), zero);
+}
+
+// Packs two rows of 32-bit lanes (already in s16 range) to 16 bits, in order.
+static __fi __m256i pack_rows_epi16(__m256i r0, __m256i r1)
+{
+	return _mm256_permute4x64_epi64(_mm256_packs_epi32(r0, r1), _MM_SHUFFLE(3, 1, 2, 0));
+}
+#endif
+
 __ri void mpeg2_idct_copy(s16 * block, u8 * dest, const int stride)
 {
+#if defined(__AVX2__)
+	__m256i r[8];
+	idct_avx2(block, r);
+
+	// Saturating to u8 matches CLIP over the range the lut covers.
+	for (int i = 0; i < 8; i += 4)
+	{
+		__m256i p01 = pack_rows_epi16(r[i + 0], r[i + 1]);
+		__m256i p23 = pack_rows_epi16(r[i + 2], r[i + 3]);
+		// low lane: rows 0 and 2, high lane: rows 1 and 3
+		__m256i p = _mm256_packus_epi16(p01, p23);
+		__m128i lo = _mm256_castsi256_si128(p);
+		__m128i hi = _mm256_extracti128_si256(p, 1);
+
+		_mm_storel_epi64((__m128i*)(dest + stride * 0), lo);
+		_mm_storel_epi64((__m128i*)(dest + stride * 1), hi);
+		_mm_storel_epi64((__m128i*)(dest + stride * 2), _mm_unpackhi_epi64(lo, lo));
+		_mm_storel_epi64((__m128i*)(dest + stride * 3), _mm_unpackhi_epi64(hi, hi));
+		dest += stride * 4;
+	}
+#else
     int i;
 
     for (i = 0; i < 8; i++)
@@ -180,6 +321,7 @@ __ri void mpeg2_idct_copy(s16 * block, u8 * dest, const int stride)
 		dest += stride;
 		block += 8;
     } while (--i);
+#endif
 }
 
 
@@ -190,6 +332,17 @@ __ri void mpeg2_idct_add (const int last, s16 * block, s16 * dest, const int str
 
     if (last != 129 || (block[0] & 7) == 4)
     {
+#if defined(__AVX2__)
+		__m256i r[8];
+		idct_avx2(block, r);
+
+		for (int i = 0; i < 8; i += 2)
+		{
+			__m256i p = pack_rows_epi16(r[i], r[i + 1]);
+			_mm_store_si128((__m128i*)(dest + stride * i), _mm256_castsi256_si128(p));
+			_mm_store_si128((__m128i*)(dest + stride * (i + 1)), _mm256_extracti128_si256(p, 1));
+		}
+#else
 		int i;
 		for (i = 0; i < 8; i++)
 			idct_row (block + 8 * i);
@@ -204,7 +357,7 @@ __ri void mpeg2_idct_add (const int last, s16 * block, s16 * dest, const int str
 			dest += stride;
 			block += 8;
 		} while (--i);
-
+#endif
     }
     else
     {
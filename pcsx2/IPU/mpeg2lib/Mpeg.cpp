@@ -347,6 +347,8 @@ static bool get_intra_block()
 	const u8 (&quant_matrix)[64] = decoder.iq;
 	int quantizer_scale = decoder.quantizer_scale;
 	s16 * dest = decoder.DCTblock;
+	const DCTfasttab * fasttab = (decoder.intra_vlc_format && !decoder.mpeg1) ? DCTfast.b15 : DCTfast.next;
+	const DCTfasttab * fast;
 	u16 code; 
 
 	/* decode AC coefficients */
@@ -363,6 +365,26 @@ static bool get_intra_block()
 
 		code = UBITS(16);
 
+		// Short codes: run, level and sign in one probe
+		fast = &fasttab[code >> 6];
+		if (i + fast->run < 64)
+		{
+			DUMPBITS(fast->len);
+			i += fast->run;
+
+			int val = (fast->level * quantizer_scale * quant_matrix[i]) >> 4;
+			if(decoder.mpeg1)
+			{
+				/* oddification */
+				val = (val - 1) | 1;
+			}
+			val = (val ^ fast->sign) - fast->sign;
+
+			SATURATE(val);
+			dest[scan[i]] = val;
+			continue;
+		}
+
 		if (code >= 16384 && (!decoder.intra_vlc_format || decoder.mpeg1))
 		{
 		  tab = &DCT.next[(code >> 12) - 4];
@@ -505,6 +527,7 @@ static bool get_non_intra_block(int * last)
 	const u8 (&quant_matrix)[64] = decoder.niq;
 	int quantizer_scale = decoder.quantizer_scale;
 	s16 * dest = decoder.DCTblock;
+	const DCTfasttab * fast;
 	u16 code;
 
     /* decode AC coefficients */
@@ -521,6 +544,21 @@ static bool get_non_intra_block(int * last)
 
 			code = UBITS(16);
 
+			// Short codes: run, level and sign in one probe
+			fast = (i == 0) ? &DCTfast.first[code >> 6] : &DCTfast.next[code >> 6];
+			if (i + fast->run < 64)
+			{
+				DUMPBITS(fast->len);
+				i += fast->run;
+
+				val = ((2 * fast->level + 1) * quantizer_scale * quant_matrix[i]) >> 5;
+				val = (val ^ fast->sign) - fast->sign;
+
+				SATURATE(val);
+				dest[scan[i]] = val;
+				continue;
+			}
+
 			if (code >= 16384)
 			{
 				if (i==0)
@@ -663,4 +663,60 @@ static const __aligned16 DCTtabSet DCT =
 
 };
 
+// Single probe lookup for the short DCT coefficient codes, indexed by the next 10 bits of
+// the stream.  Every code of up to 9 bits is unrolled along with its sign bit, which covers
+// the bulk of the coefficients in real streams; escapes, end of block and the longer codes
+// are marked with run 0xff and still go through the DCT tables above.
+struct DCTfasttab {
+	u8 run;
+	u8 level;
+	u8 len;		// including the sign bit
+	s8 sign;	// 0 or -1
+};
+
+struct DCTfastSet
+{
+	DCTfasttab first[1024];	// Table B-14, first coefficient of non-intra blocks
+	DCTfasttab next[1024];	// Table B-14, all other coefficients
+	DCTfasttab b15[1024];	// Table B-15, intra blocks with intra_vlc_format
+
+	DCTfastSet()
+	{
+		build(first, DCT.first, DCT.tab0);
+		build(next, DCT.next, DCT.tab0);
+		build(b15, NULL, DCT.tab0a);
+	}
+
+private:
+	static void build(DCTfasttab (&dst)[1024], const DCTtab * top, const DCTtab * tab0)
+	{
+		for (uint i = 0; i < 1024; i++)
+		{
+			const uint code = i << 6;
+			const DCTtab * tab = NULL;
+
+			if (code >= 16384 && top)
+				tab = &top[(code >> 12) - 4];
+			else if (code >= 1024)
+				tab = &tab0[(code >> 8) - 4];
+
+			if (!tab || tab->run >= 64 || tab->len > 9)
+			{
+				dst[i].run = 0xff;
+				dst[i].level = 0;
+				dst[i].len = 0;
+				dst[i].sign = 0;
+				continue;
+			}
+
+			dst[i].run = tab->run;
+			dst[i].level = tab->level;
+			dst[i].len = tab->len + 1;
+			dst[i].sign = ((i >> (9 - tab->len)) & 1) ? -1 : 0;
+		}
+	}
+};
+
+static const __aligned16 DCTfastSet DCTfast;
+
 #endif//__VLC_H__
@@ -17,5 +17,10 @@
 
 extern void yuv2rgb_reference();
 
+#if defined(__AVX2__)
+#define yuv2rgb yuv2rgb_avx2
+extern void yuv2rgb_avx2();
+#else
 #define yuv2rgb yuv2rgb_sse2
+#endif
 extern void yuv2rgb_sse2();
@@ -17,6 +17,7 @@
 #include "IopCommon.h"
 
 #include "Sif.h"
+#include "MTIOP.h"
 
 using namespace R3000A;
 
@@ -198,7 +199,11 @@ void psxDma9(u32 madr, u32 bcr, u32 chcr)
 	sif0.iop.busy = true;
 	sif0.iop.end = false;
 
-	SIF0Dma();
+	// The transfer also drives the EE side of the SIF, leave it to the EE thread.
+	if (iopThread.IsSelf())
+		iopThread.PostEvent(IOP_EVENT_SIF0);
+	else
+		SIF0Dma();
 }
 
 void psxDma10(u32 madr, u32 bcr, u32 chcr)
@@ -208,7 +213,10 @@ void psxDma10(u32 madr, u32 bcr, u32 chcr)
 	sif1.iop.busy = true;
 	sif1.iop.end = false;
 
-	SIF1Dma();
+	if (iopThread.IsSelf())
+		iopThread.PostEvent(IOP_EVENT_SIF1);
+	else
+		SIF1Dma();
 }
 
 /* psxDma11 & psxDma 12 are in IopSio2.cpp, along with the appropriate interrupt functions. */
@@ -43,6 +43,14 @@ using namespace Threading;
 __aligned(32) MTGS_BufferedData RingBuffer;
 extern bool renderswitch;
 
+// How a GenericStall ended, also the index into MTGS_Stats::Stalls.
+enum MTGS_StallPhase
+{
+	StallPhase_Spin,
+	StallPhase_Yield,
+	StallPhase_Sleep,
+};
+
 
 #ifdef RINGBUF_DEBUG_STACK
 #include <list>
@@ -77,6 +85,13 @@ void SysMtgsThread::OnStart()
 
 	m_CopyDataTally		= 0;
 
+	ApplyRingSize();
+
+	m_StallSpinTicks	= GetTickFrequency() / 100000;
+	m_StallYieldTicks	= m_StallSpinTicks + GetTickFrequency() / 10000;
+	m_StatIdleTicks		= 0;
+	ResetStats();
+
 	_parent::OnStart();
 }
 
@@ -93,6 +108,14 @@ void SysMtgsThread::OnResumeReady()
 	m_sem_OpenDone.Reset();
 }
 
+void SysMtgsThread::ApplyRingSize()
+{
+	const uint factor = std::min<uint>( std::max<int>( EmuConfig.GS.RingSizeFactor, RingBufferSizeFactorMin ), RingBufferSizeFactor );
+
+	m_RingCapacity		= 1 << factor;
+	m_RingBucketShift	= factor - 3;
+}
+
 void SysMtgsThread::ResetGS()
 {
 	pxAssertDev( !IsOpen() || (m_ReadPos == m_WritePos), "Must close or terminate the GS thread prior to gsReset." );
@@ -106,6 +129,8 @@ void SysMtgsThread::ResetGS()
 	m_QueuedFrameCount    = 0;
 	m_VsyncSignalListener = 0;
 
+	ApplyRingSize();
+
 	MTGS_LOG( "MTGS: Sending Reset..." );
 	SendSimplePacket( GS_RINGTYPE_RESET, 0, 0, 0 );
 	SendSimplePacket( GS_RINGTYPE_FRAMESKIP, 0, 0, 0 );
@@ -153,7 +178,13 @@ void SysMtgsThread::PostVsyncStart()
 	// If those are needed back, it's better to increase the VsyncQueueSize via PCSX_vm.ini.
 	// (The Xenosaga engine is known to run into this, due to it throwing bulks of data in one frame followed by 2 empty frames.)
 
-	if ((m_QueuedFrameCount.fetch_add(1) < EmuConfig.GS.VsyncQueueSize) /*|| (!EmuConfig.GS.VsyncEnable && !EmuConfig.GS.FrameLimitEnable)*/) return;
+	const int queued = m_QueuedFrameCount.fetch_add(1);
+
+	m_StatFrames++;
+	m_StatQueuedFrames += queued;
+	UpdateStats();
+
+	if ((queued < EmuConfig.GS.VsyncQueueSize) /*|| (!EmuConfig.GS.VsyncEnable && !EmuConfig.GS.FrameLimitEnable)*/) return;
 
 	m_VsyncSignalListener.store(true, std::memory_order_release);
 	//Console.WriteLn( Color_Blue, "(EEcore Sleep) Vsync\t\tringpos=0x%06x, writepos=0x%06x", m_ReadPos.load(), m_WritePos.load() );
@@ -164,7 +195,9 @@ void SysMtgsThread::PostVsyncStart()
 	// So let's ensure the ring doesn't sleep
 	m_sem_event.Post();
 
+	const u64 start = GetCPUTicks();
 	m_sem_Vsync.WaitNoCancel();
+	m_StatVsyncTicks += GetCPUTicks() - start;
 }
 
 union PacketTagType
@@ -289,7 +322,10 @@ void SysMtgsThread::ExecuteTaskInThread()
 		// is very optimized (only 1 instruction test in most cases), so no point in trying
 		// to avoid it.
 
+		const u64 idleStart = GetCPUTicks();
 		m_sem_event.WaitWithoutYield();
+		m_StatIdleTicks.fetch_add(GetCPUTicks() - idleStart, std::memory_order_relaxed);
+
 		StateCheckInThread();
 		busy.Acquire();
 
@@ -680,6 +716,13 @@ void SysMtgsThread::SendDataPacket()
 	//m_PacketLocker.Release();
 }
 
+__fi bool SysMtgsThread::HasRoomFor( uint readpos, uint writepos, uint size ) const
+{
+	// An empty ring always takes the packet, even one larger than the usable capacity.
+	const uint used = (writepos - readpos) & RingBufferMask;
+	return (used == 0) || (used + size < m_RingCapacity);
+}
+
 void SysMtgsThread::GenericStall( uint size )
 {
 	// Note on volatiles: m_WritePos is not modified by the GS thread, so there's no need
@@ -697,14 +740,41 @@ void SysMtgsThread::GenericStall( uint size )
 	// the block about to be written (writepos + size)
 
 	uint readpos = m_ReadPos.load(std::memory_order_acquire);
-	uint freeroom;
 
-	if (writepos < readpos)
-		freeroom = readpos - writepos;
-	else
-		freeroom = RingBufferSize - (writepos - readpos);
+	const uint used = (writepos - readpos) & RingBufferMask;
+	m_StatOccupancy[std::min( used >> m_RingBucketShift, MTGS_Stats::OccupancyBuckets - 1 )]++;
+
+	if (HasRoomFor(readpos, writepos, size)) return;
+
+	// Most stalls are short: FMVs typically send *very* little data to the GS, and a busy
+	// GS usually frees the room within a few microseconds.  Sleeping the EEcore on those is
+	// a waste of time, so spin first, then give up the timeslice, and only sleep once the
+	// wait has outlasted both (learned) budgets.
+
+	const u64 start = GetCPUTicks();
+	uint phase = StallPhase_Spin;
+
+	SetEvent();
+	while(true) {
+		if (phase == StallPhase_Spin)
+			SpinWait();
+		else
+			Timeslice();
 
-	if (freeroom <= size)
+		readpos = m_ReadPos.load(std::memory_order_acquire);
+		if (HasRoomFor(readpos, writepos, size)) break;
+
+		const u64 waited = GetCPUTicks() - start;
+		if (waited >= m_StallYieldTicks)
+		{
+			phase = StallPhase_Sleep;
+			break;
+		}
+		if (waited >= m_StallSpinTicks)
+			phase = StallPhase_Yield;
+	}
+
+	if (phase == StallPhase_Sleep)
 	{
 		// writepos will overlap readpos if we commit the data, so we need to wait until
 		// readpos is out past the end of the future write pos, or until it wraps around
@@ -714,54 +784,103 @@ void SysMtgsThread::GenericStall( uint size )
 		// the next packet will likely stall up too.  So lets set a condition for the MTGS
 		// thread to wake up the EE once there's a sizable chunk of the ringbuffer emptied.
 
-		uint somedone	= (RingBufferSize - freeroom) / 4;
-		if( somedone < size+1 ) somedone = size + 1;
+		int somedone	= ((writepos - readpos) & RingBufferMask) / 4;
+		if( somedone < (int)size+1 ) somedone = size + 1;
 
-		// FMV Optimization: FMVs typically send *very* little data to the GS, in some cases
-		// every other frame is nothing more than a page swap.  Sleeping the EEcore is a
-		// waste of time, and we get better results using a spinwait.
+		pxAssertDev( m_SignalRingEnable == 0, "MTGS Thread Synchronization Error" );
+		m_SignalRingPosition.store(somedone, std::memory_order_release);
 
-		if( somedone > 0x80 )
-		{
-			pxAssertDev( m_SignalRingEnable == 0, "MTGS Thread Synchronization Error" );
-			m_SignalRingPosition.store(somedone, std::memory_order_release);
+		//Console.WriteLn( Color_Blue, "(EEcore Sleep) PrepDataPacker \tringpos=0x%06x, writepos=0x%06x, signalpos=0x%06x", readpos, writepos, m_SignalRingPosition );
 
-			//Console.WriteLn( Color_Blue, "(EEcore Sleep) PrepDataPacker \tringpos=0x%06x, writepos=0x%06x, signalpos=0x%06x", readpos, writepos, m_SignalRingPosition );
+		while(true) {
+			m_SignalRingEnable.store(true, std::memory_order_release);
+			SetEvent();
+			m_sem_OnRingReset.WaitWithoutYield();
+			readpos = m_ReadPos.load(std::memory_order_acquire);
+			//Console.WriteLn( Color_Blue, "(EEcore Awake) Report!\tringpos=0x%06x", readpos );
 
-			while(true) {
-				m_SignalRingEnable.store(true, std::memory_order_release);
-				SetEvent();
-				m_sem_OnRingReset.WaitWithoutYield();
-				readpos = m_ReadPos.load(std::memory_order_acquire);
-				//Console.WriteLn( Color_Blue, "(EEcore Awake) Report!\tringpos=0x%06x", readpos );
+			if (HasRoomFor(readpos, writepos, size)) break;
+		}
 
-				if (writepos < readpos)
-					freeroom = readpos - writepos;
-				else
-					freeroom = RingBufferSize - (writepos - readpos);
+		pxAssertDev( m_SignalRingPosition <= 0, "MTGS Thread Synchronization Error" );
+	}
 
-				if (freeroom > size) break;
-			}
+	LearnStall( phase, GetCPUTicks() - start );
+}
 
-			pxAssertDev( m_SignalRingPosition <= 0, "MTGS Thread Synchronization Error" );
-		}
-		else
-		{
-			//Console.WriteLn( Color_StrongGray, "(EEcore Spin) PrepDataPacket!" );
-			SetEvent();
-			while(true) {
-				SpinWait();
-				readpos = m_ReadPos.load(std::memory_order_acquire);
+// Waits that got through while spinning or yielding pull the spin budget towards twice
+// their length, so that the common stall on this host doesn't pay for a context switch.
+// Waits that had to sleep anyway pull it back down, their spinning only took a core away
+// from the GS.
+void SysMtgsThread::LearnStall( uint phase, u64 ticks )
+{
+	const s64 freq		= GetTickFrequency();
+	const s64 minSpin	= std::max<s64>( freq / 1000000, 1 );
+	const s64 maxSpin	= freq / 10000;
 
-				if (writepos < readpos)
-					freeroom = readpos - writepos;
-				else
-					freeroom = RingBufferSize - (writepos - readpos);
+	const s64 target	= (phase == StallPhase_Sleep) ? 0 : (s64)ticks * 2;
+	s64 spin			= (s64)m_StallSpinTicks + (target - (s64)m_StallSpinTicks) / 8;
 
-				if (freeroom > size) break;
-			}
-		}
+	m_StallSpinTicks	= std::min( std::max( spin, minSpin ), maxSpin );
+	m_StallYieldTicks	= m_StallSpinTicks + std::max<u64>( m_StallSpinTicks * 4, freq / 10000 );
+
+	m_StatStalls[phase]++;
+	m_StatStallTicks += ticks;
+}
+
+void SysMtgsThread::ResetStats()
+{
+	m_StatStart			= GetCPUTicks();
+	m_StatStallTicks	= 0;
+	m_StatVsyncTicks	= 0;
+	m_StatFrames		= 0;
+	m_StatQueuedFrames	= 0;
+
+	memzero( m_StatStalls );
+	memzero( m_StatOccupancy );
+}
+
+// Publishes the telemetry counters about once a second (called on vsyncs, by the EE).
+void SysMtgsThread::UpdateStats()
+{
+	const u64 freq = GetTickFrequency();
+	const u64 period = GetCPUTicks() - m_StatStart;
+	if (period < freq) return;
+
+	const double toMs = 1000.0 / (double)freq;
+
+	MTGS_Stats stats;
+	stats.Period		= period * toMs;
+	stats.EEStallTime	= m_StatStallTicks * toMs;
+	stats.EEVsyncTime	= m_StatVsyncTicks * toMs;
+	stats.GSIdleTime	= m_StatIdleTicks.exchange(0, std::memory_order_relaxed) * toMs;
+	stats.SpinTime		= m_StallSpinTicks * 1000000.0 / (double)freq;
+	stats.Frames		= m_StatFrames;
+	stats.QueuedFrames	= m_StatFrames ? (double)m_StatQueuedFrames / m_StatFrames : 0.0;
+
+	memcpy( stats.Stalls, m_StatStalls, sizeof(stats.Stalls) );
+	memcpy( stats.Occupancy, m_StatOccupancy, sizeof(stats.Occupancy) );
+
+	if (stats.Stalls[StallPhase_Spin] || stats.Stalls[StallPhase_Yield] || stats.Stalls[StallPhase_Sleep])
+	{
+		const uint* o = stats.Occupancy;
+		DevCon.WriteLn( "MTGS: EE stalled %.2f ms (%u spin, %u yield, %u sleep), vsync %.2f ms, GS idle %.2f ms, ring [%u %u %u %u %u %u %u %u]",
+			stats.EEStallTime, stats.Stalls[StallPhase_Spin], stats.Stalls[StallPhase_Yield], stats.Stalls[StallPhase_Sleep],
+			stats.EEVsyncTime, stats.GSIdleTime, o[0], o[1], o[2], o[3], o[4], o[5], o[6], o[7] );
 	}
+
+	{
+		ScopedLock lock( m_mtx_Stats );
+		m_Stats = stats;
+	}
+
+	ResetStats();
+}
+
+MTGS_Stats SysMtgsThread::GetStats()
+{
+	ScopedLock lock( m_mtx_Stats );
+	return m_Stats;
 }
 
 void SysMtgsThread::PrepDataPacket( MTGS_RingCommand cmd, u32 size )
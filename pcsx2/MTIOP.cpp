@@ -0,0 +1,142 @@
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2002-2010  PCSX2 Dev Team
+ *
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "PrecompiledHeader.h"
+#include "Common.h"
+#include "IopCommon.h"
+#include "Sif.h"
+#include "MTIOP.h"
+
+IOP_Thread iopThread;
+
+IOP_Thread::IOP_Thread()
+{
+	m_name = L"MTIOP";
+	m_kicked = 0;
+	m_processed = 0;
+	m_events = 0;
+	m_ato_ee_waiting = false;
+	m_eeCycles = 0;
+	m_outstanding = false;
+
+	m_syncs = 0;
+	m_stalls = 0;
+	m_stallTicks = 0;
+	m_frames = 0;
+}
+
+IOP_Thread::~IOP_Thread()
+{
+	try {
+		pxThread::Cancel();
+	}
+	DESTRUCTOR_CATCHALL
+}
+
+void IOP_Thread::ExecuteTaskInThread()
+{
+	for(;;) {
+		semaEvent.WaitWithoutYield();
+
+		u32 kicked = m_kicked.load(std::memory_order_acquire);
+		if (kicked == m_processed.load(std::memory_order_relaxed)) continue;
+
+		m_eeCycles = psxCpu->ExecuteBlock(m_eeCycles);
+
+		// seq_cst, see Wait()
+		m_processed.store(kicked);
+		if (m_ato_ee_waiting.load() && m_ato_ee_waiting.exchange(false))
+			semaDone.Post();
+	}
+}
+
+void IOP_Thread::Kick(s32 eeCycles)
+{
+	pxAssert(IsDone());
+	if (!IsRunning()) Start();
+
+	m_eeCycles = eeCycles;
+	m_outstanding = true;
+	m_kicked.store(m_kicked.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+	semaEvent.Post();
+}
+
+bool IOP_Thread::IsDone()
+{
+	return m_processed.load(std::memory_order_acquire) == m_kicked.load(std::memory_order_relaxed);
+}
+
+// Eventcount style handshake with ExecuteTaskInThread(), like VU0_Thread::WaitVU(): the
+// EE raises m_ato_ee_waiting and only then rechecks m_processed, while the IOP thread
+// stores m_processed and only then checks the flag.
+void IOP_Thread::Wait()
+{
+	if (!m_outstanding) return;
+
+	if (!IsDone()) {
+		u64 start = GetCPUTicks();
+		m_ato_ee_waiting.store(true);
+		if (m_processed.load() == m_kicked.load(std::memory_order_relaxed)) {
+			// Raced with the IOP thread; if it already took the flag its post is
+			// on the way, and must be eaten before the next wait.
+			if (!m_ato_ee_waiting.exchange(false))
+				semaDone.WaitWithoutYield();
+		}
+		else
+			semaDone.WaitWithoutYield();
+		m_stalls++;
+		m_stallTicks += GetCPUTicks() - start;
+	}
+
+	m_syncs++;
+	m_outstanding = false;
+	EEsCycle = m_eeCycles;
+
+	DeliverEvents();
+}
+
+void IOP_Thread::PostEvent(IOP_EVENT ev)
+{
+	m_events.fetch_or(ev, std::memory_order_relaxed);
+
+	// Give the rest of the slice back to the EE, so that the DMA starts as soon as possible.
+	iopBreak += iopCycleEE;
+	iopCycleEE = 0;
+}
+
+void IOP_Thread::DeliverEvents()
+{
+	if (!m_events.load(std::memory_order_relaxed)) return;
+
+	u32 events = m_events.exchange(0);
+
+	if (events & IOP_EVENT_SIF0) SIF0Dma();
+	if (events & IOP_EVENT_SIF1) SIF1Dma();
+	if (events & IOP_EVENT_SIF2) SIF2Dma();
+}
+
+void IOP_Thread::ReportSyncStats()
+{
+	if (++m_frames < 300) return;
+
+	if (m_syncs)
+		DevCon.WriteLn("MTIOP: %u syncs, %u stalled (%.2f ms)", m_syncs, m_stalls,
+			(double)m_stallTicks * 1000.0 / (double)GetTickFrequency());
+
+	m_frames = 0;
+	m_syncs = 0;
+	m_stalls = 0;
+	m_stallTicks = 0;
+}
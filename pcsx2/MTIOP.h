@@ -0,0 +1,88 @@
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2002-2010  PCSX2 Dev Team
+ *
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+#include "System/SysThreads.h"
+
+// Work raised by the IOP thread that touches EE state, and is therefore carried out by
+// the EE thread once it has joined the IOP.
+enum IOP_EVENT {
+	IOP_EVENT_SIF0 = 1 << 0, // IOP started its SIF0 channel (psxDma9)
+	IOP_EVENT_SIF1 = 1 << 1, // IOP started its SIF1 channel (psxDma10)
+	IOP_EVENT_SIF2 = 1 << 2, // IOP side of a SIF2 transfer wants to continue (sif2Interrupt)
+};
+
+// Notes:
+// - Runs the IOP timeslices (psxCpu->ExecuteBlock) on their own thread when the iopThread
+//   speedhack is enabled.  The EE event test joins the previous slice, runs iopEventTest
+//   and then kicks the next one, so the IOP runs alongside the EE code that follows instead
+//   of in line with it.
+// - The EE never runs more than IopSkew cycles past a kick before its next event test,
+//   which bounds how far the two cpus can drift apart.
+// - Every EE access to state the IOP owns or shares (SIF DMA, the SBUS registers in the
+//   0x1000Fxxx page, IOP memory and hw registers seen from the EE, the CDVD/DEV9/SPU2
+//   pages, savestates, reset, suspend and shutdown) calls Wait() first.  SIF DMA started
+//   by the IOP is posted as an IOP_EVENT and carried out by the EE thread in Wait().
+// - Plugins: while a slice runs, the SPU2, CDVD, PAD (through SIO), USB and DEV9 plugins
+//   and the memcards are only called from the IOP thread; Open/Close/Freeze and the vsync
+//   work (sioNextFrame) run on the core thread with the IOP joined.  So each plugin sees
+//   one caller at a time, but not always the same thread.  Of the plugins we ship only
+//   LilyPad checks the calling thread there, and its Update() takes a lock and forwards
+//   to its window thread when called from any other thread.
+// - The EE and IOP recompilers share the iCore register allocator, so recompiles take
+//   g_recCompileLock.
+class IOP_Thread : public pxThread {
+	__aligned(64) std::atomic<u32> m_kicked;    // Only modified by EE thread
+	__aligned(64) std::atomic<u32> m_processed; // Only modified by IOP thread
+	__aligned(64) std::atomic<u32> m_events;
+	__aligned(64) std::atomic<bool> m_ato_ee_waiting; // EE is asleep on semaDone
+	Semaphore semaEvent;
+	Semaphore semaDone;
+
+	s32  m_eeCycles;	// EEsCycle handed to the slice, and what the slice left of it
+	bool m_outstanding;	// A slice was kicked and hasn't been joined yet (EE thread only)
+
+	// Sync telemetry, reported every few hundred frames
+	u32 m_syncs;
+	u32 m_stalls;
+	u64 m_stallTicks;
+	u32 m_frames;
+
+public:
+	IOP_Thread();
+	virtual ~IOP_Thread();
+
+	// Hands the given EE cycles (EEsCycle) over to the IOP thread.
+	void Kick(s32 eeCycles);
+
+	// Used for assertions...
+	bool IsDone();
+
+	// Waits till the IOP thread is done with its slice, copies the cycles it didn't run back
+	// to EEsCycle and delivers its events.
+	void Wait();
+
+	// Called by the IOP thread
+	void PostEvent(IOP_EVENT ev);
+
+	// Called by the EE thread at vsync
+	void ReportSyncStats();
+
+protected:
+	void DeliverEvents();
+	void ExecuteTaskInThread();
+};
+
+extern IOP_Thread iopThread;
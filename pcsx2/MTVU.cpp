@@ -20,6 +20,7 @@
 #include "Gif_Unit.h"
 
 __aligned16 VU_Thread vu1Thread(CpuVU1, VU1);
+VU0_Thread vu0Thread;
 
 #define MTVU_ALWAYS_KICK 0
 #define MTVU_SYNC_MODE   0
@@ -34,7 +35,7 @@ enum MTVU_EVENT {
 	MTVU_VIF_WRITE_COL,  // Write to Vif col reg
 	MTVU_VIF_WRITE_ROW,  // Write to Vif row reg
 	MTVU_VIF_UNPACK,     // Execute Vif Unpack
-	MTVU_NULL_PACKET,    // Go back to beginning of buffer
+	MTVU_NULL_PACKET,    // Wrap marker, go back to beginning of buffer
 	MTVU_RESET
 };
 
@@ -85,6 +86,9 @@ void VU_Thread::Reset()
 	m_write_pos     = 0;
 	m_ato_read_pos  = 0;
 	m_read_pos      = 0;
+	m_ato_ee_wait_size = 0;
+	m_ato_vu0_waiting = false;
+	m_ato_vu0_wait_pos = 0;
 	memzero(vif);
 	memzero(vifRegs);
 	for (size_t i = 0; i < 4; ++i)
@@ -144,12 +148,12 @@ void VU_Thread::ExecuteRingBuffer()
 					Read(&vif.tag, vif_copy_size);
 					ReadRegs(&vifRegs);
 					u32 size = Read();
-					MTVU_Unpack(&buffer[m_read_pos], vifRegs);
+					MTVU_Unpack(&buffer[m_read_pos & buffer_mask], vifRegs);
 					m_read_pos += size_u32(size);
 					break;
 				}
 				case MTVU_NULL_PACKET:
-					m_read_pos = 0;
+					m_read_pos = (m_read_pos + buffer_mask) & ~buffer_mask;
 					break;
 				jNO_DEFAULT;
 			}
@@ -160,42 +164,49 @@ void VU_Thread::ExecuteRingBuffer()
 }
 
 
-// Should only be called by ReserveSpace()
-__ri void VU_Thread::WaitOnSize(s32 size)
+// Sleeps the EE until the ring has at least 'size' free u32's.
+//
+// Eventcount style handshake with CommitReadPos(): the EE publishes the free space it
+// needs in m_ato_ee_wait_size and only then rechecks the read pos, while the VU thread
+// publishes the read pos and only then checks the wait size.  Both sides are seq_cst,
+// so either the recheck sees the new read pos or the VU thread sees the wait size, and
+// posts semaRingSpace once that much space is free (at the latest when the ring drains).
+// The EE is woken up once per wait, not once per packet.
+__ri void VU_Thread::WaitOnSize(u32 size)
 {
-	for(;;) {
-		s32 readPos  = GetReadPos();
-		if (readPos <= m_write_pos) break; // MTVU is reading in back of write_pos
-		// FIXME greg: there is a bug somewhere in the queue pointer
-		// management. It creates a deadlock/corruption in SotC intro (before
-		// the first menu). I added a 4KB safety net which seem to avoid to
-		// trigger the bug.
-		// Note: a wait lock instead of a yield also helps to avoid the bug.
-		if (readPos >  m_write_pos + size + _4kb) break; // Enough free front space
-		{ // Let MTVU run to free up buffer space
-			KickStart();
-			// Locking might trigger a full flush of the ring buffer. Yield
-			// will be more aggressive, and only flush the minimal size.
-			// Performance will be smoother but it will consume extra CPU cycle
-			// on the EE thread (not an issue on 4 cores).
-			std::this_thread::yield();
+	pxAssert(size > 0 && size <= buffer_size);
+
+	while (GetFreeSpace() < size) {
+		KickStart(true);
+
+		m_ato_ee_wait_size.store(size);
+		if (GetFreeSpace() >= size) {
+			// Raced with the VU thread; if it already took the wait size its post
+			// is on the way, and must be eaten before the next wait.
+			if (!m_ato_ee_wait_size.exchange(0))
+				semaRingSpace.WaitWithoutYield();
+			break;
 		}
+		semaRingSpace.WaitWithoutYield();
 	}
 }
 
 // Makes sure theres enough room in the ring buffer
 // to write a continuous 'size * sizeof(u32)' bytes
-void VU_Thread::ReserveSpace(s32 size)
+void VU_Thread::ReserveSpace(u32 size)
 {
-	pxAssert(m_write_pos < buffer_size);
-	pxAssert(size      < buffer_size);
 	pxAssert(size > 0);
+	pxAssert(size < buffer_size);
+
+	const u32 index = m_write_pos & buffer_mask;
 
-	if (m_write_pos + size > (buffer_size - 1)) {
-		WaitOnSize(1); // Size of MTVU_NULL_PACKET
-		Write(MTVU_NULL_PACKET);
-		// Reset local write pointer/position
-		m_write_pos = 0;
+	if (index + size > buffer_size) {
+		// Not enough contiguous room before the end of the buffer: mark the rest of
+		// this lap as skipped and continue at the start of the next one.
+		const u32 skip = buffer_size - index;
+		WaitOnSize(skip);
+		buffer[index] = MTVU_NULL_PACKET;
+		m_write_pos += skip;
 		CommitWritePos();
 	}
 
@@ -203,22 +214,28 @@ void VU_Thread::ReserveSpace(s32 size)
 }
 
 // Use this when reading read_pos from ee thread
-__fi s32 VU_Thread::GetReadPos()
+__fi u32 VU_Thread::GetReadPos()
 {
 	return m_ato_read_pos.load(std::memory_order_acquire);
 }
 
 // Use this when reading write_pos from vu thread
-__fi s32 VU_Thread::GetWritePos()
+__fi u32 VU_Thread::GetWritePos()
 {
 	return m_ato_write_pos.load(std::memory_order_acquire);
 }
 
+// Free space in the ring, in u32's (ee thread)
+__fi u32 VU_Thread::GetFreeSpace()
+{
+	// seq_cst, see WaitOnSize()
+	return buffer_size - (m_write_pos - m_ato_read_pos.load());
+}
+
 // Gets the effective write pointer after
 __fi u32* VU_Thread::GetWritePtr()
 {
-	pxAssert(m_write_pos < buffer_size);
-	return &buffer[m_write_pos];
+	return &buffer[m_write_pos & buffer_mask];
 }
 
 __fi void VU_Thread::CommitWritePos()
@@ -231,25 +248,36 @@ __fi void VU_Thread::CommitWritePos()
 
 __fi void VU_Thread::CommitReadPos()
 {
-	m_ato_read_pos.store(m_read_pos, std::memory_order_release);
+	// seq_cst, see WaitOnSize()
+	m_ato_read_pos.store(m_read_pos);
+
+	// The EE commits everything it wrote before it waits, so the write pos is stable here.
+	u32 wait_size = m_ato_ee_wait_size.load();
+	if (wait_size && buffer_size - (GetWritePos() - m_read_pos) >= wait_size
+	&& m_ato_ee_wait_size.exchange(0))
+		semaRingSpace.Post();
+
+	if (m_ato_vu0_waiting.load() && (s32)(m_read_pos - m_ato_vu0_wait_pos.load()) >= 0
+	&& m_ato_vu0_waiting.exchange(false))
+		semaVU0Drained.Post();
 }
 
 __fi u32 VU_Thread::Read()
 {
-	u32 ret = buffer[m_read_pos];
+	u32 ret = buffer[m_read_pos & buffer_mask];
 	m_read_pos++;
 	return ret;
 }
 
 __fi void VU_Thread::Read(void* dest, u32 size)
 {
-	memcpy(dest, &buffer[m_read_pos], size);
+	memcpy(dest, &buffer[m_read_pos & buffer_mask], size);
 	m_read_pos += size_u32(size);
 }
 
 __fi void VU_Thread::ReadRegs(VIFregisters* dest)
 {
-	VIFregistersMTVU* src = (VIFregistersMTVU*)&buffer[m_read_pos];
+	VIFregistersMTVU* src = (VIFregistersMTVU*)&buffer[m_read_pos & buffer_mask];
 	dest->cycle = src->cycle;
 	dest->mode = src->mode;
 	dest->num = src->num;
@@ -307,14 +335,35 @@ bool VU_Thread::IsDone()
 void VU_Thread::WaitVU()
 {
 	MTVU_LOG("MTVU - WaitVU!");
-	for(;;) {
-		if (IsDone()) break;
-		//DevCon.WriteLn("WaitVU()");
-		pxAssert(THREAD_VU1);
-		KickStart();
-		std::this_thread::yield(); // Give a chance to the MTVU thread to actually start
-		ScopedLock lock(mtxBusy);
+	if (IsDone()) return;
+	pxAssert(THREAD_VU1);
+
+	// The read pos is only committed once a packet has been fully processed, so an
+	// empty ring means VU1 is done with everything queued.
+	WaitOnSize(buffer_size);
+}
+
+// The VU0 thread can't use the EE's wait size, so it sleeps on its own semaphore, with the
+// same handshake as WaitOnSize(), till the read pos reaches the write pos it saw on entry.
+// It doesn't wait for the ring to drain: the EE may keep committing packets without kicking
+// them (WriteMicroMem, WriteDataMem...) and then join VU0, and nobody would kick those.
+void VU_Thread::WaitVUFromVU0()
+{
+	const u32 target = GetWritePos();
+	if ((s32)(m_ato_read_pos.load() - target) >= 0) return;
+
+	KickStart(true); // Everything up to target is committed, this gets it processed
+
+	m_ato_vu0_wait_pos.store(target);
+	m_ato_vu0_waiting.store(true);
+	if ((s32)(m_ato_read_pos.load() - target) >= 0) {
+		// Raced with the VU thread; if it already took the flag its post is on
+		// the way, and must be eaten before the next wait.
+		if (!m_ato_vu0_waiting.exchange(false))
+			semaVU0Drained.WaitWithoutYield();
+		return;
 	}
+	semaVU0Drained.WaitWithoutYield();
 }
 
 void VU_Thread::ExecuteVU(u32 vu_addr, u32 vif_top, u32 vif_itop)
@@ -385,3 +434,111 @@ void VU_Thread::WriteRow(vifStruct& _vif)
 	Write(&_vif.MaskRow, sizeof(_vif.MaskRow));
 	CommitWritePos();
 }
+
+// --------------------------------------------------------------------------------------
+//  VU0_Thread  (implementations)
+// --------------------------------------------------------------------------------------
+VU0_Thread::VU0_Thread()
+{
+	m_name = L"MTVU0";
+	m_kicked = 0;
+	m_processed = 0;
+	m_ato_ee_waiting = false;
+	m_ato_break = false;
+	m_cycles = 0;
+	outstanding = false;
+	vpuStat = 0;
+}
+
+VU0_Thread::~VU0_Thread()
+{
+	try {
+		pxThread::Cancel();
+	}
+	DESTRUCTOR_CATCHALL
+}
+
+void VU0_Thread::ExecuteTaskInThread()
+{
+	PCSX2_PAGEFAULT_PROTECT {
+		ExecuteProgram();
+	} PCSX2_PAGEFAULT_EXCEPT;
+}
+
+void VU0_Thread::ExecuteProgram()
+{
+	for(;;) {
+		semaEvent.WaitWithoutYield();
+
+		u32 kicked = m_kicked.load(std::memory_order_acquire);
+		if (kicked == m_processed.load(std::memory_order_relaxed)) continue;
+
+		u32 startcycle = VU0.cycle;
+		do { // Run VU0 until it finishes or the EE stops it, M-bit breaks don't matter here
+			CpuVU0->Execute(vu0RunCycles);
+			if (m_ato_break.load(std::memory_order_acquire)) {
+				vpuStat &= ~1;
+				break;
+			}
+		} while (vpuStat & 1);
+		m_cycles = VU0.cycle - startcycle;
+
+		// seq_cst, see WaitVU()
+		m_processed.store(kicked);
+		if (m_ato_ee_waiting.load() && m_ato_ee_waiting.exchange(false))
+			semaDone.Post();
+	}
+}
+
+void VU0_Thread::Kick()
+{
+	pxAssert(IsDone());
+	if (!IsRunning()) Start();
+
+	vpuStat = VU0.VI[REG_VPU_STAT].UL & 0xff;
+	outstanding = true;
+	m_ato_break.store(false, std::memory_order_relaxed);
+	m_kicked.store(m_kicked.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+	semaEvent.Post();
+}
+
+bool VU0_Thread::IsDone()
+{
+	return m_processed.load(std::memory_order_acquire) == m_kicked.load(std::memory_order_relaxed);
+}
+
+void VU0_Thread::Break()
+{
+	if (outstanding) m_ato_break.store(true, std::memory_order_release);
+}
+
+// Eventcount style handshake with ExecuteProgram(), like VU_Thread::WaitOnSize(): the EE
+// raises m_ato_ee_waiting and only then rechecks m_processed, while the VU0 thread stores
+// m_processed and only then checks the flag.
+void VU0_Thread::WaitVU()
+{
+	if (!outstanding) return;
+
+	if (!IsDone()) {
+		m_ato_ee_waiting.store(true);
+		if (m_processed.load() == m_kicked.load(std::memory_order_relaxed)) {
+			// Raced with the VU0 thread; if it already took the flag its post is
+			// on the way, and must be eaten before the next wait.
+			if (!m_ato_ee_waiting.exchange(false))
+				semaDone.WaitWithoutYield();
+		}
+		else
+			semaDone.WaitWithoutYield();
+	}
+	outstanding = false;
+
+	// What the VU0 code does itself when it isn't threaded (see mVUendProgram/mVUcleanUp)
+	VU0.VI[REG_VPU_STAT].UL = (VU0.VI[REG_VPU_STAT].UL & ~0xff) | (vpuStat & 0xff);
+	vif0Regs.stat.VEW = false;
+	cpuRegs.cycle += std::min(m_cycles, 3000u) * EmuConfig.Speedhacks.EECycleSkip;
+
+	if (VU0.flags & VUFLAG_INTCINTERRUPT) {
+		VU0.flags &= ~VUFLAG_INTCINTERRUPT;
+		hwIntcIrq(6);
+	}
+}
@@ -25,19 +25,30 @@
 // Notes:
 // - This class should only be accessed from the EE thread...
 // - buffer_size must be power of 2
-// - ring-buffer has no complete pending packets when read_pos==write_pos
+// - read/write positions are free running sequence numbers (in u32's), the ring index
+//   is the position masked by buffer_size-1.  The ring holds write_pos-read_pos u32's,
+//   so it is empty when read_pos==write_pos and full when they are buffer_size apart.
+// - packets are contiguous in the buffer; a packet that doesn't fit before the end of
+//   the buffer is preceded by a MTVU_NULL_PACKET wrap marker, which moves both positions
+//   to the start of the next lap.
 class VU_Thread : public pxThread {
-	static const s32 buffer_size = (_1mb * 16) / sizeof(s32);
+	static const u32 buffer_size = (_1mb * 16) / sizeof(u32);
+	static const u32 buffer_mask = buffer_size - 1;
 
 	u32 buffer[buffer_size];
 	// Note: keep atomic on separate cache line to avoid CPU conflict
 	__aligned(64) std::atomic<bool> isBusy;   // Is thread processing data?
-	__aligned(64) std::atomic<int> m_ato_read_pos; // Only modified by VU thread
-	__aligned(64) std::atomic<int> m_ato_write_pos;    // Only modified by EE thread
-	__aligned(64) int  m_read_pos; // temporary read pos (local to the VU thread)
-	int  m_write_pos; // temporary write pos (local to the EE thread)
+	__aligned(64) std::atomic<u32> m_ato_read_pos; // Only modified by VU thread
+	__aligned(64) std::atomic<u32> m_ato_write_pos;    // Only modified by EE thread
+	__aligned(64) u32  m_read_pos; // temporary read pos (local to the VU thread)
+	u32  m_write_pos; // temporary write pos (local to the EE thread)
+	__aligned(64) std::atomic<u32> m_ato_ee_wait_size; // Free space the EE is asleep on semaRingSpace for (0 = none)
+	__aligned(64) std::atomic<bool> m_ato_vu0_waiting; // VU0 thread is asleep on semaVU0Drained...
+	std::atomic<u32> m_ato_vu0_wait_pos;               // ...till the read pos reaches this
 	Mutex     mtxBusy;
 	Semaphore semaEvent;
+	Semaphore semaRingSpace;
+	Semaphore semaVU0Drained;
 	BaseVUmicroCPU*& vuCPU;
 	VURegs&          vuRegs;
 
@@ -62,6 +73,10 @@ public:
 	// Waits till MTVU is done processing
 	void WaitVU();
 
+	// Waits till MTVU is done with the packets committed so far, for the VU0 thread
+	// (see VU0_Thread)
+	void WaitVUFromVU0();
+
 	void ExecuteVU(u32 vu_addr, u32 vif_top, u32 vif_itop);
 
 	void VifUnpack(vifStruct& _vif, VIFregisters& _vifRegs, u8* data, u32 size);
@@ -82,11 +97,12 @@ protected:
 private:
 	void ExecuteRingBuffer();
 
-	void WaitOnSize(s32 size);
-	void ReserveSpace(s32 size);
+	void WaitOnSize(u32 size);
+	void ReserveSpace(u32 size);
 
-	s32 GetReadPos();
-	s32 GetWritePos();
+	u32 GetReadPos();
+	u32 GetWritePos();
+	u32 GetFreeSpace();
 
 	u32* GetWritePtr();
 
@@ -105,3 +121,54 @@ private:
 };
 
 extern __aligned16 VU_Thread vu1Thread;
+
+// Notes:
+// - Runs VU0 micro programs (VCALLMS/VCALLMSR, CMSAR0 writes, VIF0 MSCAL) to completion on
+//   their own thread, in vu0RunCycles slices so that a FBRST write can stop them, when the vu0Thread speedhack is enabled, so that they overlap with the
+//   EE code that follows the call instead of running in line with it.
+// - The EE joins the thread (WaitVU) before anything that reads or writes VU0 state: the
+//   COP2 ops (see vu0ThreadSyncsOnCOP2), LQC2/SQC2, VU0 memory accesses and clears, savestates
+//   and reset.  The event test also joins it as soon as the program is done.
+// - While a program is outstanding the EE keeps seeing VPU_STAT.VBS0 and VIF0_STAT.VEW set.
+//   The VU0 code reports its VPU_STAT bits in vpuStat instead (the EE keeps writing the VU1
+//   bits of VPU_STAT meanwhile), and the EE merges them back and raises the VU0 interrupt
+//   when it joins.
+class VU0_Thread : public pxThread {
+	__aligned(64) std::atomic<u32> m_kicked;    // Only modified by EE thread
+	__aligned(64) std::atomic<u32> m_processed; // Only modified by VU0 thread
+	__aligned(64) std::atomic<bool> m_ato_ee_waiting; // EE is asleep on semaDone
+	__aligned(64) std::atomic<bool> m_ato_break;      // EE wants the program stopped (FBRST)
+	Semaphore semaEvent;
+	Semaphore semaDone;
+
+	u32  m_cycles;		// VU0 cycles the last program ran for
+
+public:
+	__aligned(64) u32 vpuStat; // VPU_STAT's VU0 bits, as written by the VU0 thread
+	bool outstanding;	// A program was kicked and hasn't been joined yet (EE thread only, tested by the EE rec)
+
+	VU0_Thread();
+	virtual ~VU0_Thread();
+
+	// Runs VU0 from its TPC till the E-bit on the VU0 thread
+	void Kick();
+
+	// Used for assertions...
+	bool IsDone();
+
+	// Stops the outstanding program at the end of its current slice (FBRST force break
+	// or reset).  The EE still has to join it.
+	void Break();
+
+	// Waits till the VU0 thread is done with its program, and hands the results back
+	// to the EE (VPU_STAT, VIF0_STAT.VEW, the VU0 interrupt)
+	void WaitVU();
+
+protected:
+	void ExecuteTaskInThread();
+
+private:
+	void ExecuteProgram();
+};
+
+extern VU0_Thread vu0Thread;
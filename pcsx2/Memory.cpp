@@ -41,6 +41,8 @@ BIOS
 #include "GS.h"
 #include "VUmicro.h"
 #include "MTVU.h"
+#include "MTIOP.h"
+#include "COP0.h"
 
 #include "ps2/HwInternal.h"
 #include "ps2/BiosTools.h"
@@ -103,6 +105,7 @@ static vtlbHandler
 
 	vu0_micro_mem,
 	vu1_micro_mem,
+	vu0_data_mem,
 	vu1_data_mem,
 
 	hw_by_page[0x10] = { 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF},
@@ -112,8 +115,25 @@ static vtlbHandler
 
 	iopHw_by_page_01,
 	iopHw_by_page_03,
-	iopHw_by_page_08;
+	iopHw_by_page_08,
 
+	iop_ram_mem;
+
+// Set when VU0 data memory is mapped through the vuData handlers rather than directly.
+static bool vu0DataHandlers = false;
+
+// Set when IOP memory is mapped through the iopRam handlers rather than directly.
+static bool iopRamHandlers = false;
+
+static void memMapVU0Data()
+{
+	// VU0 is 4k, mirrored 4 times across a 16k area (the vuData handlers mask the address).
+	// The threaded VU0 needs the handlers so that EE accesses wait for it, everyone else
+	// gets the direct mapping.
+	vu0DataHandlers = THREAD_VU0;
+	if (vu0DataHandlers) vtlb_MapHandler(vu0_data_mem,0x11004000,0x00004000);
+	else                 vtlb_MapBlock  (VU0.Mem,     0x11004000,0x00004000,0x1000);
+}
 
 void memMapVUmicro()
 {
@@ -131,8 +151,7 @@ void memMapVUmicro()
 	vtlb_MapHandler(vu1_micro_mem,0x11008000,0x00004000);
 
 	// VU0/VU1 memory (data)
-	// VU0 is 4k, mirrored 4 times across a 16k area.
-	vtlb_MapBlock(VU0.Mem,0x11004000,0x00004000,0x1000);
+	memMapVU0Data();
 	// Note: In order for the below conditional to work correctly
 	// support needs to be coded to reset the memMappings when MTVU is
 	// turned off/on. For now we just always use the vu data handlers...
@@ -140,6 +159,15 @@ void memMapVUmicro()
 	else               vtlb_MapBlock  (VU1.Mem,     0x1100c000,0x00004000);
 }
 
+static void memMapIopRam()
+{
+	// The threaded IOP needs the handlers so that EE accesses wait for its slice, everyone
+	// else gets the direct mapping.
+	iopRamHandlers = THREAD_IOP;
+	if (iopRamHandlers) vtlb_MapHandler(iop_ram_mem, 0x1c000000,0x00800000);
+	else                vtlb_MapBlock  (iopMem->Main,0x1c000000,0x00800000);
+}
+
 void memMapPhy()
 {
 	// Main memory
@@ -156,7 +184,7 @@ void memMapPhy()
 	// IOP memory
 	// (used by the EE Bios Kernel during initial hardware initialization, Apps/Games
 	//  are "supposed" to use the thread-safe SIF instead.)
-	vtlb_MapBlock(iopMem->Main,0x1c000000,0x00800000);
+	memMapIopRam();
 
 	// Generic Handlers; These fallback to mem* stuff...
 	vtlb_MapHandler(tlb_fallback_7,0x14000000, _64kb);
@@ -247,9 +275,18 @@ static void __fastcall nullWrite128(u32 mem, const mem128_t *value)
 	MEM_LOG("Write uninstalled memory at address %08x", mem);
 }
 
+// Pages 3 (CDVD), 7 (DEV9) and 8 (SPU2) belong to the IOP's devices.  With the threaded IOP
+// the EE has to wait for the IOP's slice before it touches them.
+template<int p>
+static __fi void _ext_memWaitIop()
+{
+	if ((p == 3 || p == 7 || p == 8) && THREAD_IOP) iopThread.Wait();
+}
+
 template<int p>
 static mem8_t __fastcall _ext_memRead8 (u32 mem)
 {
+	_ext_memWaitIop<p>();
 	switch (p)
 	{
 		case 3: // psh4
@@ -273,6 +310,7 @@ static mem8_t __fastcall _ext_memRead8 (u32 mem)
 template<int p>
 static mem16_t __fastcall _ext_memRead16(u32 mem)
 {
+	_ext_memWaitIop<p>();
 	switch (p)
 	{
 		case 4: // b80
@@ -303,6 +341,7 @@ static mem16_t __fastcall _ext_memRead16(u32 mem)
 template<int p>
 static mem32_t __fastcall _ext_memRead32(u32 mem)
 {
+	_ext_memWaitIop<p>();
 	switch (p)
 	{
 		case 6: // gsm
@@ -355,6 +394,7 @@ static void __fastcall _ext_memRead128(u32 mem, mem128_t *out)
 template<int p>
 static void __fastcall _ext_memWrite8 (u32 mem, mem8_t  value)
 {
+	_ext_memWaitIop<p>();
 	switch (p) {
 		case 3: // psh4
 			psxHw4Write8(mem, value); return;
@@ -374,6 +414,7 @@ static void __fastcall _ext_memWrite8 (u32 mem, mem8_t  value)
 template<int p>
 static void __fastcall _ext_memWrite16(u32 mem, mem16_t value)
 {
+	_ext_memWaitIop<p>();
 	switch (p) {
 		case 5: // ba0
 			MEM_LOG("ba00000 Memory write16 to  address %x with data %x", mem, value);
@@ -395,6 +436,7 @@ static void __fastcall _ext_memWrite16(u32 mem, mem16_t value)
 template<int p>
 static void __fastcall _ext_memWrite32(u32 mem, mem32_t value)
 {
+	_ext_memWaitIop<p>();
 	switch (p) {
 		case 6: // gsm
 			gsWrite32(mem, value); return;
@@ -441,6 +483,114 @@ static void __fastcall _ext_memWrite128(u32 mem, const mem128_t *value)
 	cpuTlbMissW(mem, cpuRegs.branch);
 }
 
+// --------------------------------------------------------------------------------------
+//  EE side views of IOP state for the threaded IOP
+// --------------------------------------------------------------------------------------
+// IOP memory (2MB, mirrored across the 8MB window).  Only mapped with the threaded IOP,
+// see memMapIopRam.
+static __fi u8* iopRamPtr(u32 mem)
+{
+	iopThread.Wait();
+	return &iopMem->Main[mem & (Ps2MemSize::IopRam-1)];
+}
+
+static mem8_t  __fastcall iopRamRead8  (u32 mem)                  { return *(mem8_t*) iopRamPtr(mem); }
+static mem16_t __fastcall iopRamRead16 (u32 mem)                  { return *(mem16_t*)iopRamPtr(mem); }
+static mem32_t __fastcall iopRamRead32 (u32 mem)                  { return *(mem32_t*)iopRamPtr(mem); }
+static void    __fastcall iopRamRead64 (u32 mem, mem64_t* out)    { *out = *(mem64_t*)iopRamPtr(mem); }
+static void    __fastcall iopRamRead128(u32 mem, mem128_t* out)   { CopyQWC(out, iopRamPtr(mem)); }
+static void    __fastcall iopRamWrite8  (u32 mem, mem8_t value)   { *(mem8_t*) iopRamPtr(mem) = value; }
+static void    __fastcall iopRamWrite16 (u32 mem, mem16_t value)  { *(mem16_t*)iopRamPtr(mem) = value; }
+static void    __fastcall iopRamWrite32 (u32 mem, mem32_t value)  { *(mem32_t*)iopRamPtr(mem) = value; }
+static void    __fastcall iopRamWrite64 (u32 mem, const mem64_t* value)  { *(mem64_t*)iopRamPtr(mem) = *value; }
+static void    __fastcall iopRamWrite128(u32 mem, const mem128_t* value) { CopyQWC(iopRamPtr(mem), value); }
+
+// IOP hw registers: page 0 is the generic handler, 1/3/8 the per-page ones.  These are
+// shared with the IOP's own memory map, so the wait lives here rather than in IopHw.
+template<int page>
+static mem8_t __fastcall eeIopHwRead8(u32 mem)
+{
+	if (THREAD_IOP) iopThread.Wait();
+	using namespace IopMemory;
+	switch (page)
+	{
+		case 1: return iopHwRead8_Page1(mem);
+		case 3: return iopHwRead8_Page3(mem);
+		case 8: return iopHwRead8_Page8(mem);
+		default: return iopHwRead8_generic(mem);
+	}
+}
+
+template<int page>
+static mem16_t __fastcall eeIopHwRead16(u32 mem)
+{
+	if (THREAD_IOP) iopThread.Wait();
+	using namespace IopMemory;
+	switch (page)
+	{
+		case 1: return iopHwRead16_Page1(mem);
+		case 3: return iopHwRead16_Page3(mem);
+		case 8: return iopHwRead16_Page8(mem);
+		default: return iopHwRead16_generic(mem);
+	}
+}
+
+template<int page>
+static mem32_t __fastcall eeIopHwRead32(u32 mem)
+{
+	if (THREAD_IOP) iopThread.Wait();
+	using namespace IopMemory;
+	switch (page)
+	{
+		case 1: return iopHwRead32_Page1(mem);
+		case 3: return iopHwRead32_Page3(mem);
+		case 8: return iopHwRead32_Page8(mem);
+		default: return iopHwRead32_generic(mem);
+	}
+}
+
+template<int page>
+static void __fastcall eeIopHwWrite8(u32 mem, mem8_t value)
+{
+	if (THREAD_IOP) iopThread.Wait();
+	using namespace IopMemory;
+	switch (page)
+	{
+		case 1: iopHwWrite8_Page1(mem, value); return;
+		case 3: iopHwWrite8_Page3(mem, value); return;
+		case 8: iopHwWrite8_Page8(mem, value); return;
+		default: iopHwWrite8_generic(mem, value); return;
+	}
+}
+
+template<int page>
+static void __fastcall eeIopHwWrite16(u32 mem, mem16_t value)
+{
+	if (THREAD_IOP) iopThread.Wait();
+	using namespace IopMemory;
+	switch (page)
+	{
+		case 1: iopHwWrite16_Page1(mem, value); return;
+		case 3: iopHwWrite16_Page3(mem, value); return;
+		case 8: iopHwWrite16_Page8(mem, value); return;
+		default: iopHwWrite16_generic(mem, value); return;
+	}
+}
+
+template<int page>
+static void __fastcall eeIopHwWrite32(u32 mem, mem32_t value)
+{
+	if (THREAD_IOP) iopThread.Wait();
+	using namespace IopMemory;
+	switch (page)
+	{
+		case 1: iopHwWrite32_Page1(mem, value); return;
+		case 3: iopHwWrite32_Page3(mem, value); return;
+		case 8: iopHwWrite32_Page8(mem, value); return;
+		default: iopHwWrite32_generic(mem, value); return;
+	}
+}
+
 #define vtlb_RegisterHandlerTempl1(nam,t) vtlb_RegisterHandler(nam##Read8<t>,nam##Read16<t>,nam##Read32<t>,nam##Read64<t>,nam##Read128<t>, \
 															   nam##Write8<t>,nam##Write16<t>,nam##Write32<t>,nam##Write64<t>,nam##Write128<t>)
 
@@ -456,6 +606,7 @@ template<int vunum> static mem8_t __fc vuMicroRead8(u32 addr) {
 	VURegs* vu = vunum ?  &VU1 :  &VU0;
 	addr      &= vunum ? 0x3fff: 0xfff;
 	
+	if (!vunum && THREAD_VU0) vu0Thread.WaitVU();
 	if (vunum && THREAD_VU1) vu1Thread.WaitVU();
 	return vu->Micro[addr];
 }
@@ -463,6 +614,7 @@ template<int vunum> static mem16_t __fc vuMicroRead16(u32 addr) {
 	VURegs* vu = vunum ?  &VU1 :  &VU0;
 	addr      &= vunum ? 0x3fff: 0xfff;
 	
+	if (!vunum && THREAD_VU0) vu0Thread.WaitVU();
 	if (vunum && THREAD_VU1) vu1Thread.WaitVU();
 	return *(u16*)&vu->Micro[addr];
 }
@@ -470,6 +622,7 @@ template<int vunum> static mem32_t __fc vuMicroRead32(u32 addr) {
 	VURegs* vu = vunum ?  &VU1 :  &VU0;
 	addr      &= vunum ? 0x3fff: 0xfff;
 	
+	if (!vunum && THREAD_VU0) vu0Thread.WaitVU();
 	if (vunum && THREAD_VU1) vu1Thread.WaitVU();
 	return *(u32*)&vu->Micro[addr];
 }
@@ -477,12 +630,14 @@ template<int vunum> static void __fc vuMicroRead64(u32 addr,mem64_t* data) {
 	VURegs* vu = vunum ?  &VU1 :  &VU0;
 	addr      &= vunum ? 0x3fff: 0xfff;
 	
+	if (!vunum && THREAD_VU0) vu0Thread.WaitVU();
 	if (vunum && THREAD_VU1) vu1Thread.WaitVU();
 	*data=*(u64*)&vu->Micro[addr];
 }
 template<int vunum> static void __fc vuMicroRead128(u32 addr,mem128_t* data) {
 	VURegs* vu = vunum ?  &VU1 :  &VU0;
 	addr      &= vunum ? 0x3fff: 0xfff;
+	if (!vunum && THREAD_VU0) vu0Thread.WaitVU();
 	if (vunum && THREAD_VU1) vu1Thread.WaitVU();
 	
 	CopyQWC(data,&vu->Micro[addr]);
@@ -494,6 +649,7 @@ template<int vunum> static void __fc vuMicroWrite8(u32 addr,mem8_t data) {
 	VURegs* vu = vunum ?  &VU1 :  &VU0;
 	addr      &= vunum ? 0x3fff: 0xfff;
 	
+	if (!vunum && THREAD_VU0) vu0Thread.WaitVU();
 	if (vunum && THREAD_VU1) {
 		vu1Thread.WriteMicroMem(addr, &data, sizeof(u8));
 		return;
@@ -507,6 +663,7 @@ template<int vunum> static void __fc vuMicroWrite16(u32 addr, mem16_t data) {
 	VURegs* vu = vunum ?  &VU1 :  &VU0;
 	addr      &= vunum ? 0x3fff: 0xfff;
 	
+	if (!vunum && THREAD_VU0) vu0Thread.WaitVU();
 	if (vunum && THREAD_VU1) {
 		vu1Thread.WriteMicroMem(addr, &data, sizeof(u16));
 		return;
@@ -520,6 +677,7 @@ template<int vunum> static void __fc vuMicroWrite32(u32 addr, mem32_t data) {
 	VURegs* vu = vunum ?  &VU1 :  &VU0;
 	addr      &= vunum ? 0x3fff: 0xfff;
 	
+	if (!vunum && THREAD_VU0) vu0Thread.WaitVU();
 	if (vunum && THREAD_VU1) {
 		vu1Thread.WriteMicroMem(addr, &data, sizeof(u32));
 		return;
@@ -533,6 +691,7 @@ template<int vunum> static void __fc vuMicroWrite64(u32 addr, const mem64_t* dat
 	VURegs* vu = vunum ?  &VU1 :  &VU0;
 	addr      &= vunum ? 0x3fff: 0xfff;
 
+	if (!vunum && THREAD_VU0) vu0Thread.WaitVU();
 	if (vunum && THREAD_VU1) {
 		vu1Thread.WriteMicroMem(addr, (void*)data, sizeof(u64));
 		return;
@@ -547,6 +706,7 @@ template<int vunum> static void __fc vuMicroWrite128(u32 addr, const mem128_t* d
 	VURegs* vu = vunum ?  &VU1 :  &VU0;
 	addr      &= vunum ? 0x3fff: 0xfff;
 
+	if (!vunum && THREAD_VU0) vu0Thread.WaitVU();
 	if (vunum && THREAD_VU1) {
 		vu1Thread.WriteMicroMem(addr, (void*)data, sizeof(u128));
 		return;
@@ -561,30 +721,35 @@ template<int vunum> static void __fc vuMicroWrite128(u32 addr, const mem128_t* d
 template<int vunum> static mem8_t __fc vuDataRead8(u32 addr) {
 	VURegs* vu = vunum ?  &VU1 :  &VU0;
 	addr      &= vunum ? 0x3fff: 0xfff;
+	if (!vunum && THREAD_VU0) vu0Thread.WaitVU();
 	if (vunum && THREAD_VU1) vu1Thread.WaitVU();
 	return vu->Mem[addr];
 }
 template<int vunum> static mem16_t __fc vuDataRead16(u32 addr) {
 	VURegs* vu = vunum ?  &VU1 :  &VU0;
 	addr      &= vunum ? 0x3fff: 0xfff;
+	if (!vunum && THREAD_VU0) vu0Thread.WaitVU();
 	if (vunum && THREAD_VU1) vu1Thread.WaitVU();
 	return *(u16*)&vu->Mem[addr];
 }
 template<int vunum> static mem32_t __fc vuDataRead32(u32 addr) {
 	VURegs* vu = vunum ?  &VU1 :  &VU0;
 	addr      &= vunum ? 0x3fff: 0xfff;
+	if (!vunum && THREAD_VU0) vu0Thread.WaitVU();
 	if (vunum && THREAD_VU1) vu1Thread.WaitVU();
 	return *(u32*)&vu->Mem[addr];
 }
 template<int vunum> static void __fc vuDataRead64(u32 addr, mem64_t* data) {
 	VURegs* vu = vunum ?  &VU1 :  &VU0;
 	addr      &= vunum ? 0x3fff: 0xfff;
+	if (!vunum && THREAD_VU0) vu0Thread.WaitVU();
 	if (vunum && THREAD_VU1) vu1Thread.WaitVU();
 	*data=*(u64*)&vu->Mem[addr];
 }
 template<int vunum> static void __fc vuDataRead128(u32 addr, mem128_t* data) {
 	VURegs* vu = vunum ?  &VU1 :  &VU0;
 	addr      &= vunum ? 0x3fff: 0xfff;
+	if (!vunum && THREAD_VU0) vu0Thread.WaitVU();
 	if (vunum && THREAD_VU1) vu1Thread.WaitVU();
 	CopyQWC(data,&vu->Mem[addr]);
 }
@@ -593,6 +758,7 @@ template<int vunum> static void __fc vuDataRead128(u32 addr, mem128_t* data) {
 template<int vunum> static void __fc vuDataWrite8(u32 addr, mem8_t data) {
 	VURegs* vu = vunum ?  &VU1 :  &VU0;
 	addr      &= vunum ? 0x3fff: 0xfff;
+	if (!vunum && THREAD_VU0) vu0Thread.WaitVU();
 	if (vunum && THREAD_VU1) {
 		vu1Thread.WriteDataMem(addr, &data, sizeof(u8));
 		return;
@@ -602,6 +768,7 @@ template<int vunum> static void __fc vuDataWrite8(u32 addr, mem8_t data) {
 template<int vunum> static void __fc vuDataWrite16(u32 addr, mem16_t data) {
 	VURegs* vu = vunum ?  &VU1 :  &VU0;
 	addr      &= vunum ? 0x3fff: 0xfff;
+	if (!vunum && THREAD_VU0) vu0Thread.WaitVU();
 	if (vunum && THREAD_VU1) {
 		vu1Thread.WriteDataMem(addr, &data, sizeof(u16));
 		return;
@@ -611,6 +778,7 @@ template<int vunum> static void __fc vuDataWrite16(u32 addr, mem16_t data) {
 template<int vunum> static void __fc vuDataWrite32(u32 addr, mem32_t data) {
 	VURegs* vu = vunum ?  &VU1 :  &VU0;
 	addr      &= vunum ? 0x3fff: 0xfff;
+	if (!vunum && THREAD_VU0) vu0Thread.WaitVU();
 	if (vunum && THREAD_VU1) {
 		vu1Thread.WriteDataMem(addr, &data, sizeof(u32));
 		return;
@@ -620,6 +788,7 @@ template<int vunum> static void __fc vuDataWrite32(u32 addr, mem32_t data) {
 template<int vunum> static void __fc vuDataWrite64(u32 addr, const mem64_t* data) {
 	VURegs* vu = vunum ?  &VU1 :  &VU0;
 	addr      &= vunum ? 0x3fff: 0xfff;
+	if (!vunum && THREAD_VU0) vu0Thread.WaitVU();
 	if (vunum && THREAD_VU1) {
 		vu1Thread.WriteDataMem(addr, (void*)data, sizeof(u64));
 		return;
@@ -629,6 +798,7 @@ template<int vunum> static void __fc vuDataWrite64(u32 addr, const mem64_t* data
 template<int vunum> static void __fc vuDataWrite128(u32 addr, const mem128_t* data) {
 	VURegs* vu = vunum ?  &VU1 :  &VU0;
 	addr      &= vunum ? 0x3fff: 0xfff;
+	if (!vunum && THREAD_VU0) vu0Thread.WaitVU();
 	if (vunum && THREAD_VU1) {
 		vu1Thread.WriteDataMem(addr, (void*)data, sizeof(u128));
 		return;
@@ -698,6 +868,27 @@ void memBindConditionalHandlers()
 			hwWrite8<0x0f>,	hwWrite16<0x0f>,	hwWrite32<0x0f>,	hwWrite64<0x0f>,	hwWrite128<0x0f>
 		);
 	}
+
+	// The threaded VU0 can be toggled without a reset: swap the VU0 data mapping, and
+	// rebuild the virtual mappings that were made from it (KSEG0/KSEG1/direct and TLB).
+	if (vu0DataHandlers != THREAD_VU0)
+	{
+		memMapVU0Data();
+		vtlb_VMap(0x11004000, 0x11004000, 0x00004000);
+		vtlb_VMap(0x91004000, 0x11004000, 0x00004000);
+		vtlb_VMap(0xB1004000, 0x11004000, 0x00004000);
+		for(int i=0; i<48; i++) MapTLB(i);
+	}
+
+	// Same for IOP memory and the threaded IOP.
+	if (iopRamHandlers != THREAD_IOP)
+	{
+		memMapIopRam();
+		vtlb_VMap(0x1c000000, 0x1c000000, 0x00800000);
+		vtlb_VMap(0x9c000000, 0x1c000000, 0x00800000);
+		vtlb_VMap(0xbc000000, 0x1c000000, 0x00800000);
+		for(int i=0; i<48; i++) MapTLB(i);
+	}
 }
 
 
@@ -757,6 +948,7 @@ void eeMemoryReserve::Reset()
 	// Dynarec versions of VUs
 	vu0_micro_mem = vtlb_RegisterHandlerTempl1(vuMicro,0);
 	vu1_micro_mem = vtlb_RegisterHandlerTempl1(vuMicro,1);
+	vu0_data_mem  = vtlb_RegisterHandlerTempl1(vuData,0);
 	vu1_data_mem  = (1||THREAD_VU1) ? vtlb_RegisterHandlerTempl1(vuData,1) : 0;
 	
 	//////////////////////////////////////////////////////////////////////////////////////////
@@ -765,27 +957,18 @@ void eeMemoryReserve::Reset()
 	// the 0x1f80 segment, and then another oddball page for CDVD in the 0x1f40 segment.
 	//
 
-	using namespace IopMemory;
-
-	tlb_fallback_2 = vtlb_RegisterHandler(
-		iopHwRead8_generic, iopHwRead16_generic, iopHwRead32_generic, _ext_memRead64<2>, _ext_memRead128<2>,
-		iopHwWrite8_generic, iopHwWrite16_generic, iopHwWrite32_generic, _ext_memWrite64<2>, _ext_memWrite128<2>
-	);
-
-	iopHw_by_page_01 = vtlb_RegisterHandler(
-		iopHwRead8_Page1, iopHwRead16_Page1, iopHwRead32_Page1, _ext_memRead64<2>, _ext_memRead128<2>,
-		iopHwWrite8_Page1, iopHwWrite16_Page1, iopHwWrite32_Page1, _ext_memWrite64<2>, _ext_memWrite128<2>
-	);
+#define eeIopHwHandlerTmpl(page) \
+	eeIopHwRead8<page>,  eeIopHwRead16<page>,  eeIopHwRead32<page>,  _ext_memRead64<2>,  _ext_memRead128<2>, \
+	eeIopHwWrite8<page>, eeIopHwWrite16<page>, eeIopHwWrite32<page>, _ext_memWrite64<2>, _ext_memWrite128<2>
 
-	iopHw_by_page_03 = vtlb_RegisterHandler(
-		iopHwRead8_Page3, iopHwRead16_Page3, iopHwRead32_Page3, _ext_memRead64<2>, _ext_memRead128<2>,
-		iopHwWrite8_Page3, iopHwWrite16_Page3, iopHwWrite32_Page3, _ext_memWrite64<2>, _ext_memWrite128<2>
-	);
+	tlb_fallback_2   = vtlb_RegisterHandler( eeIopHwHandlerTmpl(0) );
+	iopHw_by_page_01 = vtlb_RegisterHandler( eeIopHwHandlerTmpl(1) );
+	iopHw_by_page_03 = vtlb_RegisterHandler( eeIopHwHandlerTmpl(3) );
+	iopHw_by_page_08 = vtlb_RegisterHandler( eeIopHwHandlerTmpl(8) );
 
-	iopHw_by_page_08 = vtlb_RegisterHandler(
-		iopHwRead8_Page8, iopHwRead16_Page8, iopHwRead32_Page8, _ext_memRead64<2>, _ext_memRead128<2>,
-		iopHwWrite8_Page8, iopHwWrite16_Page8, iopHwWrite32_Page8, _ext_memWrite64<2>, _ext_memWrite128<2>
-	);
+	// IOP memory, mapped through these only with the threaded IOP (see memMapIopRam)
+	iop_ram_mem = vtlb_RegisterHandler(iopRamRead8, iopRamRead16, iopRamRead32, iopRamRead64, iopRamRead128,
+		iopRamWrite8, iopRamWrite16, iopRamWrite32, iopRamWrite64, iopRamWrite128);
 
 
 	// psHw Optimized Mappings
@@ -811,6 +994,8 @@ void eeMemoryReserve::Reset()
 	hw_by_page[0xd] = vtlb_RegisterHandler( hwHandlerTmpl(0x0d) );
 	hw_by_page[0xe] = vtlb_RegisterHandler( hwHandlerTmpl(0x0e) );
 	hw_by_page[0xf] = vtlb_NewHandler();		// redefined later based on speedhacking prefs
+	vu0DataHandlers = THREAD_VU0;				// mapped below, by memMapVUmicro
+	iopRamHandlers  = THREAD_IOP;				// mapped below, by memMapPhy
 	memBindConditionalHandlers();
 
 	//////////////////////////////////////////////////////////////////////
@@ -50,6 +50,7 @@ Pcsx2Config::SpeedhackOptions& Pcsx2Config::SpeedhackOptions::DisableAll()
 	bitset			= 0;
 	EECycleRate		= 0;
 	EECycleSkip		= 0;
+	IopSkew			= 1024;
 	
 	return *this;
 }
@@ -65,6 +66,11 @@ void Pcsx2Config::SpeedhackOptions::LoadSave( IniInterface& ini )
 	IniBitBool( WaitLoop );
 	IniBitBool( vuFlagHack );
 	IniBitBool( vuThread );
+	IniBitBool( ipuThread );
+	IniBitBool( iopThread );
+	IniBitBool( hwPoll );
+	IniBitBool( vu0Thread );
+	IniBitfield( IopSkew );
 }
 
 void Pcsx2Config::ProfilerOptions::LoadSave( IniInterface& ini )
@@ -205,6 +211,7 @@ Pcsx2Config::GSOptions::GSOptions()
 
 	SynchronousMTGS			= false;
 	VsyncQueueSize			= 2;
+	RingSizeFactor			= 19;
 
 	FramesToDraw			= 2;
 	FramesToSkip			= 2;
@@ -220,6 +227,7 @@ void Pcsx2Config::GSOptions::LoadSave( IniInterface& ini )
 
 	IniEntry( SynchronousMTGS );
 	IniEntry( VsyncQueueSize );
+	IniEntry( RingSizeFactor );
 
 	IniEntry( FrameLimitEnable );
 	IniEntry( FrameSkipEnable );
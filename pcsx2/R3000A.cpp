@@ -19,6 +19,8 @@
 
 #include "Sio.h"
 #include "Sif.h"
+#include "EventQueue.h"
+#include "MTIOP.h"
 
 using namespace R3000A;
 
@@ -61,6 +63,7 @@ void psxReset()
 	iopBreak = 0;
 	iopCycleEE = -1;
 	g_iopNextEventCycle = psxRegs.cycle + 4;
+	psxRebuildEventQueue();
 
 	psxHwReset();
 	PSXCLK = 36864000;
@@ -109,6 +112,14 @@ void __fastcall psxException(u32 code, u32 bd)
 	}*/
 }
 
+// Pending PSX_INT events, ordered by the cycle they are due at.
+static EventQueue<32> iopEvents;
+
+void psxRebuildEventQueue()
+{
+	iopEvents.Rebuild( psxRegs );
+}
+
 __fi void psxSetNextBranch( u32 startCycle, s32 delta )
 {
 	// typecast the conditional to signed so that things don't blow up
@@ -141,6 +152,7 @@ __fi void PSX_INT( IopEventId n, s32 ecycle )
 
 	psxRegs.sCycle[n] = psxRegs.cycle;
 	psxRegs.eCycle[n] = ecycle;
+	iopEvents.Schedule( n, psxRegs.sCycle[n] + psxRegs.eCycle[n] );
 
 	psxSetNextBranchDelta( ecycle );
 
@@ -156,31 +168,39 @@ __fi void PSX_INT( IopEventId n, s32 ecycle )
 
 static __fi void IopTestEvent( IopEventId n, void (*callback)() )
 {
+	if( !iopEvents.TakeDue( n ) ) return;
 	if( !(psxRegs.interrupt & (1 << n)) ) return;
 
 	if( psxTestCycle( psxRegs.sCycle[n], psxRegs.eCycle[n] ) )
 	{
 		psxRegs.interrupt &= ~(1 << n);
 		callback();
+		iopEvents.CollectDue( psxRegs );
 	}
 	else
-		psxSetNextBranch( psxRegs.sCycle[n], psxRegs.eCycle[n] );
+		iopEvents.Schedule( n, psxRegs.sCycle[n] + psxRegs.eCycle[n] );
 }
 
 static __fi void _psxTestInterrupts()
 {
-	IopTestEvent(IopEvt_SIF0,		sif0Interrupt);	// SIF0
-	IopTestEvent(IopEvt_SIF1,		sif1Interrupt);	// SIF1
-	IopTestEvent(IopEvt_SIF2,		sif2Interrupt);	// SIF2
-	// Originally controlled by a preprocessor define, now PSX dependent.
-	if (psxHu32(HW_ICFG) & (1 << 3)) IopTestEvent(IopEvt_SIO, sioInterruptR);
-	IopTestEvent(IopEvt_CdvdRead,	cdvdReadInterrupt);
+	iopEvents.CollectDue( psxRegs );
+
+	if( iopEvents.GetDue() )
+	{
+		IopTestEvent(IopEvt_SIF0,		sif0Interrupt);	// SIF0
+		IopTestEvent(IopEvt_SIF1,		sif1Interrupt);	// SIF1
+		IopTestEvent(IopEvt_SIF2,		sif2Interrupt);	// SIF2
+		// Originally controlled by a preprocessor define, now PSX dependent.
+		// (a due SIO event stays due until it's enabled)
+		if (psxHu32(HW_ICFG) & (1 << 3)) IopTestEvent(IopEvt_SIO, sioInterruptR);
+		IopTestEvent(IopEvt_CdvdRead,	cdvdReadInterrupt);
+	}
 
 	// Profile-guided Optimization (sorta)
 	// The following ints are rarely called.  Encasing them in a conditional
 	// as follows helps speed up most games.
 
-	if( psxRegs.interrupt & ((1 << IopEvt_Cdvd) | (1 << IopEvt_Dma11) | (1 << IopEvt_Dma12)
+	if( iopEvents.GetDue() & ((1 << IopEvt_Cdvd) | (1 << IopEvt_Dma11) | (1 << IopEvt_Dma12)
 		| (1 << IopEvt_Cdrom) | (1 << IopEvt_CdromRead) | (1 << IopEvt_DEV9) | (1 << IopEvt_USB)))
 	{
 		IopTestEvent(IopEvt_Cdvd,		cdvdActionInterrupt);
@@ -191,6 +211,9 @@ static __fi void _psxTestInterrupts()
 		IopTestEvent(IopEvt_DEV9,		dev9Interrupt);
 		IopTestEvent(IopEvt_USB,		usbInterrupt);
 	}
+
+	if( !iopEvents.IsEmpty() )
+		psxSetNextBranch( iopEvents.GetNextDue(), 0 );
 }
 
 __ri void iopEventTest()
@@ -231,7 +254,13 @@ void iopTestIntc()
 	if( psxHu32(0x1078) == 0 ) return;
 	if( (psxHu32(0x1070) & psxHu32(0x1074)) == 0 ) return;
 
-	if( !eeEventTestIsActive )
+	if( iopThread.IsSelf() )
+	{
+		// The threaded IOP runs its own event tests, the EE's are none of its business.
+		if( !iopEventTestIsActive )
+			psxSetNextBranchDelta( 2 );
+	}
+	else if( !eeEventTestIsActive )
 	{
 		// An iop exception has occurred while the EE is running code.
 		// Inform the EE to branch so the IOP can handle it promptly:
@@ -199,6 +199,7 @@ extern R3000Acpu psxInt;
 extern R3000Acpu psxRec;
 
 extern void psxReset();
+extern void psxRebuildEventQueue();
 extern void __fastcall psxException(u32 code, u32 step);
 extern void iopEventTest();
 extern void psxMemReset();
@@ -23,12 +23,15 @@
 #include "VUmicro.h"
 #include "COP0.h"
 #include "MTVU.h"
+#include "EventQueue.h"
 
 #include "System/SysThreads.h"
 #include "R5900Exceptions.h"
 
 #include "Hardware.h"
 #include "IPU/IPUdma.h"
+#include "IPU/IPU_Thread.h"
+#include "MTIOP.h"
 
 #include "Elfheader.h"
 #include "CDVD/CDVD.h"
@@ -72,6 +75,8 @@ extern SysMainMemory& GetVmMemory();
 void cpuReset()
 {
 	vu1Thread.WaitVU();
+	vu0Thread.WaitVU();
+	iopThread.Wait();
 	if (GetMTGS().IsOpen())
 		GetMTGS().WaitGS();		// GS better be done processing before we reset the EE, just in case.
 
@@ -89,6 +94,7 @@ void cpuReset()
 	fpuRegs.fprc[31]		= 0x01000001; // fpu Status/Control
 
 	g_nextEventCycle = cpuRegs.cycle + 4;
+	cpuRebuildEventQueue();
 	EEsCycle = 0;
 	EEoCycle = cpuRegs.cycle;
 
@@ -265,17 +271,30 @@ __fi void cpuClearInt( uint i )
 	cpuRegs.interrupt &= ~(1 << i);
 }
 
+// Pending CPU_INT events, ordered by the cycle they are due at.
+static EventQueue<32> eeEvents;
+
+void cpuRebuildEventQueue()
+{
+	eeEvents.Rebuild( cpuRegs );
+}
+
 static __fi void TESTINT( u8 n, void (*callback)() )
 {
+	if( !eeEvents.TakeDue( n ) ) return;
 	if( !(cpuRegs.interrupt & (1 << n)) ) return;
 
 	if( cpuTestCycle( cpuRegs.sCycle[n], cpuRegs.eCycle[n] ) )
 	{
 		cpuClearInt( n );
 		callback();
+
+		// Events the callback has made due right away still get serviced in this pass
+		// when they come later in the order below, like they did when every slot was polled.
+		eeEvents.CollectDue( cpuRegs );
 	}
 	else
-		cpuSetNextEvent( cpuRegs.sCycle[n], cpuRegs.eCycle[n] );
+		eeEvents.Schedule( n, cpuRegs.sCycle[n] + cpuRegs.eCycle[n] );
 }
 
 // [TODO] move this function to LegacyDmac.cpp, and remove most of the DMAC-related headers from
@@ -290,16 +309,21 @@ static __fi void _cpuTestInterrupts()
 	/* These are 'pcsx2 interrupts', they handle asynchronous stuff
 	   that depends on the cycle timings */
 
-	TESTINT(DMAC_VIF1,		vif1Interrupt);	
-	TESTINT(DMAC_GIF,		gifInterrupt);
-	TESTINT(DMAC_SIF0,		EEsif0Interrupt);
-	TESTINT(DMAC_SIF1,		EEsif1Interrupt);
+	eeEvents.CollectDue( cpuRegs );
+
+	if (eeEvents.GetDue())
+	{
+		TESTINT(DMAC_VIF1,		vif1Interrupt);	
+		TESTINT(DMAC_GIF,		gifInterrupt);
+		TESTINT(DMAC_SIF0,		EEsif0Interrupt);
+		TESTINT(DMAC_SIF1,		EEsif1Interrupt);
+	}
 	
 	// Profile-guided Optimization (sorta)
 	// The following ints are rarely called.  Encasing them in a conditional
 	// as follows helps speed up most games.
 
-	if (cpuRegs.interrupt & ((1 << DMAC_VIF0) | (1 << DMAC_FROM_IPU) | (1 << DMAC_TO_IPU)
+	if (eeEvents.GetDue() & ((1 << DMAC_VIF0) | (1 << DMAC_FROM_IPU) | (1 << DMAC_TO_IPU)
 		| (1 << DMAC_FROM_SPR) | (1 << DMAC_TO_SPR) | (1 << DMAC_MFIFO_VIF) | (1 << DMAC_MFIFO_GIF)
 		| (1 << VIF_VU0_FINISH) | (1 << VIF_VU1_FINISH)))
 	{
@@ -317,6 +341,9 @@ static __fi void _cpuTestInterrupts()
 		TESTINT(VIF_VU0_FINISH, vif0VUFinish);
 		TESTINT(VIF_VU1_FINISH, vif1VUFinish);
 	}
+
+	if (!eeEvents.IsEmpty())
+		cpuSetNextEvent( eeEvents.GetNextDue(), 0 );
 }
 
 static __fi void _cpuTestTIMR()
@@ -363,6 +390,11 @@ static bool cpuIntsEnabled(int Interrupt)
 // if cpuRegs.cycle is greater than this cycle, should check cpuEventTest for updates
 u32 g_nextEventCycle = 0;
 
+// EE cycles skipped by the idle loop detection (WaitLoop speedhack) during the current
+// frame, and during the last complete one.
+u32 g_eeIdleCycles = 0;
+u32 g_eeIdleCyclesFrame = 0;
+
 // Shared portion of the branch test, called from both the Interpreter
 // and the recompiler.  (moved here to help alleviate redundant code)
 __fi void _cpuEventTest_Shared()
@@ -375,6 +407,12 @@ __fi void _cpuEventTest_Shared()
 	// cycles (fixes Grandia II [PAL], which does a spin loop on a vsync and expects to
 	// be able to read the value before the exception handler clears it).
 
+	ipuThread.DeliverEvents();
+
+	// The counters and interrupts below poke at IOP state, so the threaded IOP has to be
+	// done with its slice first.
+	iopThread.Wait();
+
 	uint mask = intcInterrupt() | dmacInterrupt();
 	if (cpuIntsEnabled(mask)) cpuException(mask, cpuRegs.branch);
 
@@ -422,15 +460,30 @@ __fi void _cpuEventTest_Shared()
 		//if( EEsCycle < -450 )
 		//	Console.WriteLn( " IOP ahead by: %d cycles", -EEsCycle );
 
-		EEsCycle = psxCpu->ExecuteBlock( EEsCycle );
-
-		iopEventAction = false;
+		if( THREAD_IOP )
+		{
+			// Cleared first, the IOP thread may raise it again for the next event test.
+			iopEventAction = false;
+			iopThread.Kick( EEsCycle );	// EEsCycle is updated when the slice is joined
+		}
+		else
+		{
+			EEsCycle = psxCpu->ExecuteBlock( EEsCycle );
+			iopEventAction = false;
+		}
 	}
 
 	// ---- VU0 -------------
 	// We're in a EventTest.  All dynarec registers are flushed
 	// so there is no need to freeze registers here.
-	CpuVU0->ExecuteBlock();
+	// The threaded VU0 is joined as soon as it's done instead, so that VPU_STAT, VIF0_STAT
+	// and the VU0 interrupt catch up even if the EE doesn't sync on COP2.
+	if( THREAD_VU0 )
+	{
+		if( vu0Thread.IsDone() ) vu0Thread.WaitVU();
+	}
+	else
+		CpuVU0->ExecuteBlock();
 
 	// Note:  We don't update the VU1 here because it runs it's micro-programs in
 	// one shot always.  That is, when a program is executed the VU1 doesn't even
@@ -438,7 +491,13 @@ __fi void _cpuEventTest_Shared()
 
 	// ---- Schedule Next Event Test --------------
 
-	if( EEsCycle > 192 )
+	if( THREAD_IOP )
+	{
+		// The IOP may still be running, so don't look at its cycle counts; instead come back
+		// within the skew window to join it.
+		cpuSetNextEventDelta( std::max<s32>( EmuConfig.Speedhacks.IopSkew, 48 ) );
+	}
+	else if( EEsCycle > 192 )
 	{
 		// EE's running way ahead of the IOP still, so we should branch quickly to give the
 		// IOP extra timeslices in short order.
@@ -449,7 +508,8 @@ __fi void _cpuEventTest_Shared()
 
 	// The IOP could be running ahead/behind of us, so adjust the iop's next branch by its
 	// relative position to the EE (via EEsCycle)
-	cpuSetNextEventDelta( ((g_iopNextEventCycle-psxRegs.cycle)*8) - EEsCycle );
+	if( !THREAD_IOP )
+		cpuSetNextEventDelta( ((g_iopNextEventCycle-psxRegs.cycle)*8) - EEsCycle );
 
 	// Apply the hsync counter's nextCycle
 	cpuSetNextEvent( hsyncCounter.sCycle, hsyncCounter.CycleT );
@@ -467,7 +527,7 @@ __ri void cpuTestINTCInts()
 	if( (psHu32(INTC_STAT) & psHu32(INTC_MASK)) == 0 ) return;
 
 	cpuSetNextEventDelta( 4 );
-	if(eeEventTestIsActive && (iopCycleEE > 0))
+	if(!THREAD_IOP && eeEventTestIsActive && (iopCycleEE > 0))
 	{
 		iopBreak += iopCycleEE;		// record the number of cycles the IOP didn't run.
 		iopCycleEE = 0;
@@ -484,7 +544,7 @@ __fi void cpuTestDMACInts()
 		 ( (psHu16(0xe010) & 0x8000) == 0) ) return;
 
 	cpuSetNextEventDelta( 4 );
-	if(eeEventTestIsActive && (iopCycleEE > 0))
+	if(!THREAD_IOP && eeEventTestIsActive && (iopCycleEE > 0))
 	{
 		iopBreak += iopCycleEE;		// record the number of cycles the IOP didn't run.
 		iopCycleEE = 0;
@@ -514,10 +574,11 @@ __fi void CPU_INT( EE_EventType n, s32 ecycle)
 	cpuRegs.interrupt|= 1 << n;
 	cpuRegs.sCycle[n] = cpuRegs.cycle;
 	cpuRegs.eCycle[n] = ecycle;
+	eeEvents.Schedule( n, cpuRegs.sCycle[n] + cpuRegs.eCycle[n] );
 
 	// Interrupt is happening soon: make sure both EE and IOP are aware.
 
-	if( ecycle <= 28 && iopCycleEE > 0 )
+	if( ecycle <= 28 && !THREAD_IOP && iopCycleEE > 0 )
 	{
 		// If running in the IOP, force it to break immediately into the EE.
 		// the EE's branch test is due to run.
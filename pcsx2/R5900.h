@@ -258,6 +258,8 @@ extern __aligned16 fpuRegisters fpuRegs;
 extern __aligned16 tlbs tlb[48];
 
 extern u32 g_nextEventCycle;
+extern u32 g_eeIdleCycles;
+extern u32 g_eeIdleCyclesFrame;
 extern bool eeEventTestIsActive;
 extern u32 s_iLastCOP0Cycle;
 extern u32 s_iLastPERFCycle[2];
@@ -438,6 +440,7 @@ extern void cpuTlbMissR(u32 addr, u32 bd);
 extern void cpuTlbMissW(u32 addr, u32 bd);
 extern void cpuTestHwInts();
 extern void cpuClearInt(uint n);
+extern void cpuRebuildEventQueue();
 extern void __fastcall GoemonPreloadTlb();
 extern void __fastcall GoemonUnloadTlb(u32 key);
 
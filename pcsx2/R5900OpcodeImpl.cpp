@@ -23,6 +23,7 @@
 #include "R5900OpcodeTables.h"
 #include "R5900Exceptions.h"
 #include "GS.h"
+#include "VUmicro.h"
 
 GS_VideoMode gsVideoMode = GS_VideoMode::Uninitialized;
 bool gsIsInterlaced = false;
@@ -260,6 +261,13 @@ void COP2()
 	//disR5900Fasm(disOut, cpuRegs.code, cpuRegs.pc);
 
 	//VU0_LOG("%s", disOut.c_str());
+
+	// The threaded VU0 has to be joined before COP2 ops touch its registers
+	if (THREAD_VU0 && vu0ThreadSyncsOnCOP2(cpuRegs.code)) {
+		if (_Rs_ == 6 && _Rd_ == REG_FBRST) vu0ThreadFBRST(cpuRegs.GPR.r[_Rt_].UL[0]); // CTC2
+		vu0Finish();
+	}
+
 	Int_COP2PrintTable[_Rs_]();
 }
 
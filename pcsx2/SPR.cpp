@@ -30,6 +30,9 @@ static void TestClearVUs(u32 madr, u32 qwc, bool isWrite)
 {
 	if (madr >= 0x11000000 && (madr < 0x11010000))
 	{
+		// The transfer goes straight to VU0 memory, so the threaded VU0 has to be done with it
+		if (madr < 0x11008000 && THREAD_VU0) vu0Thread.WaitVU();
+
 		if (madr < 0x11004000)
 		{
 			if(isWrite)
@@ -22,6 +22,7 @@
 #include "COP0.h"
 #include "VUmicro.h"
 #include "MTVU.h"
+#include "MTIOP.h"
 #include "Cache.h"
 #include "AppConfig.h"
 
@@ -45,6 +46,9 @@ static void PostLoadPrep()
 	for(int i=0; i<48; i++) MapTLB(i);
 	if (EmuConfig.Gamefixes.GoemonTlbHack) GoemonPreloadTlb();
 
+	cpuRebuildEventQueue();
+	psxRebuildEventQueue();
+
 	UpdateVSyncRate();
 }
 
@@ -153,6 +157,8 @@ static const uint MainMemorySizeInBytes =
 SaveStateBase& SaveStateBase::FreezeMainMemory()
 {
 	vu1Thread.WaitVU(); // Finish VU1 just in-case...
+	vu0Thread.WaitVU();
+	iopThread.Wait();
 	if (IsLoading()) PreLoadPrep();
 	else m_memory->MakeRoomFor( m_idx + MainMemorySizeInBytes );
 
@@ -177,6 +183,7 @@ SaveStateBase& SaveStateBase::FreezeMainMemory()
 SaveStateBase& SaveStateBase::FreezeInternals()
 {
 	vu1Thread.WaitVU(); // Finish VU1 just in-case...
+	vu0Thread.WaitVU();
 	// Print this until the MTVU problem in gifPathFreeze is taken care of (rama)
 	if (THREAD_VU1) Console.Warning("MTVU speedhack is enabled, saved states may not be stable");
 	
@@ -19,6 +19,7 @@
 
 #include "IopCommon.h"
 #include "Sif.h"
+#include "MTIOP.h"
 
 _sif sif1;
 
@@ -308,6 +309,8 @@ __fi void  EEsif1Interrupt()
 // Main difference is this checks for iop, where psxDma10 checks for ee.
 __fi void dmaSIF1()
 {
+	iopThread.Wait();
+
 	SIF_LOG(wxString(L"dmaSIF1" + sif1ch.cmqt_to_str()).To8BitData());
 
 	if (sif1.fifo.readPos != sif1.fifo.writePos)
@@ -24,6 +24,7 @@
 #include "Patch.h"
 #include "SysThreads.h"
 #include "MTVU.h"
+#include "MTIOP.h"
 
 #include "../DebugTools/MIPSAnalyst.h"
 #include "../DebugTools/SymbolMap.h"
@@ -244,6 +245,8 @@ void SysCoreThread::GameStartingInThread()
 bool SysCoreThread::StateCheckInThread()
 {
 	GetMTGS().RethrowException();
+	vu0Thread.WaitVU(); // Don't let VU0 run through a suspend, or a recompiler reset
+	iopThread.Wait();   // Same for an IOP slice kicked before execution broke out
 	return _parent::StateCheckInThread() && (_reset_stuff_as_needed(), true);
 }
 
@@ -293,6 +296,8 @@ void SysCoreThread::OnCleanupInThread()
 
 	// FIXME: temporary workaround for deadlock on exit, which actually should be a crash
 	vu1Thread.WaitVU();
+	vu0Thread.WaitVU();
+	iopThread.Wait();
 	GetCorePlugins().Close();
 	GetCorePlugins().Shutdown();
 
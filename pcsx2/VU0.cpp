@@ -29,6 +29,7 @@
 
 #include "R5900OpcodeTables.h"
 #include "VUmicro.h"
+#include "MTVU.h"
 #include "Vif_Dma.h"
 
 #define _Ft_ _Rt_
@@ -56,6 +57,10 @@ void COP2_Unknown()
 
 __fi void _vu0run(bool breakOnMbit, bool addCycles) {
 
+	// The VU0 thread always runs its program to the E-bit, so all there's left to do here
+	// is to join it.  Note that the EE isn't charged for the wait then.
+	if (THREAD_VU0) vu0Thread.WaitVU();
+
 	if (!(VU0.VI[REG_VPU_STAT].UL & 1)) return;
 
 	int startcycle = VU0.cycle;
@@ -80,6 +85,7 @@ namespace Interpreter{
 namespace OpcodeImpl
 {
 	void LQC2() {
+		if (THREAD_VU0) vu0Finish();
 		u32 addr = cpuRegs.GPR.r[_Rs_].UL[0] + (s16)cpuRegs.code;
 		if (_Ft_) {
 			memRead128(addr, VU0.VF[_Ft_].UQ);
@@ -93,6 +99,7 @@ namespace OpcodeImpl
 	//TODO: check this
 	// HUH why ? doesn't make any sense ...
 	void SQC2() {
+		if (THREAD_VU0) vu0Finish();
 		u32 addr = _Imm_ + cpuRegs.GPR.r[_Rs_].UL[0];
 		memWrite128(addr, VU0.VF[_Ft_].UQ);
 	}
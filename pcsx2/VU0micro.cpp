@@ -21,6 +21,7 @@
 #include "PrecompiledHeader.h"
 #include "Common.h"
 #include "VUmicro.h"
+#include "MTVU.h"
 
 #include <cmath>
 
@@ -34,6 +35,13 @@ void vu0ResetRegs()
 	vif0Regs.stat.VEW = false;
 }
 
+// CTC2 to FBRST joins the threaded VU0 like the other COP2 ops, and a program that spins
+// till the EE force breaks or resets it would never finish.  Stop it before the join.
+void __fastcall vu0ThreadFBRST(u32 value)
+{
+	if (value & 0x3) vu0Thread.Break();
+}
+
 void __fastcall vu0ExecMicro(u32 addr) {
 	VUM_LOG("vu0ExecMicro %x", addr);
 
@@ -47,5 +55,7 @@ void __fastcall vu0ExecMicro(u32 addr) {
 
 	if ((s32)addr != -1) VU0.VI[REG_TPC].UL = addr;
 	_vuExecMicroDebug(VU0);
-	CpuVU0->ExecuteBlock(1);
+
+	if (THREAD_VU0) vu0Thread.Kick();
+	else            CpuVU0->ExecuteBlock(1);
 }
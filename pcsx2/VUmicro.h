@@ -304,8 +304,20 @@ extern void vu0ResetRegs();
 extern void __fastcall vu0ExecMicro(u32 addr);
 extern void vu0Exec(VURegs* VU);
 extern void vu0Finish();
+extern void __fastcall vu0ThreadFBRST(u32 value);
 extern void iDumpVU0Registers();
 
+// The COP2 ops the EE joins the threaded VU0 for: all but the BC2 branches (which test
+// VPU_STAT.VBS1, VU1's busy bit) and the non-interlocked QMFC2/CFC2/QMTC2, which don't wait for VU0 on the real
+// thing either.  CTC2.NI still joins, since it can reset VU0 or run it on the EE thread.
+static __fi bool vu0ThreadSyncsOnCOP2(u32 code)
+{
+	const u32 rs = (code >> 21) & 0x1f;
+	if (rs == 8) return false;
+	if (!(code & 1) && (rs == 1 || rs == 2 || rs == 5)) return false;
+	return true;
+}
+
 // VU1
 extern void vu1Finish();
 extern void vu1ResetRegs();
@@ -17,6 +17,7 @@
 #include "Common.h"
 #include "Vif_Dma.h"
 #include "VUmicro.h"
+#include "MTVU.h"
 #include "newVif.h"
 
 u32 g_vif0Cycles = 0;
@@ -134,6 +135,18 @@ __fi void vif0SetupTransfer()
 
 __fi void vif0VUFinish()
 {
+	if (THREAD_VU0)
+	{
+		// Let the VU0 thread run alongside the EE rather than stalling on it right away,
+		// and join it once it's done
+		if (!vu0Thread.IsDone())
+		{
+			CPU_INT(VIF_VU0_FINISH, 128);
+			return;
+		}
+		vu0Thread.WaitVU();
+	}
+
 	if ((VU0.VI[REG_VPU_STAT].UL & 1))
 	{
 		int _cycles = VU0.cycle;
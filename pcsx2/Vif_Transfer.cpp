@@ -27,16 +27,23 @@ _vifT void vifTransferLoop(u32* &data) {
 	vifStruct& vifX = GetVifX;
 
 	u32& pSize = vifX.vifpacketsize;
+	const u32* start = data;
 	
 	int ret = 0;
 
 	vifXRegs.stat.VPS |= VPS_TRANSFERRING;
 	vifXRegs.stat.ER1  = false;
 	if(!idx)VIF_LOG("Starting VIF0 loop, pSize = %x, stalled = %x", pSize, vifX.vifstalled.enabled );
+
+	// Replay the unpacks of a known packet, or record them for next time
+	if (newVifDynaRec) dVifPacketReplay<idx>(data);
+
 	while (pSize > 0 && !vifX.vifstalled.enabled) {
 
 		if(!vifX.cmd) { // Get new VifCode
 
+			if (nVif[idx].recording) dVifPacketCode<idx>(start, data);
+
 			if(!vifXRegs.err.MII)
 			{
 				if(vifX.irq && !CHECK_VIF1STALLHACK) 
@@ -60,6 +67,8 @@ _vifT void vifTransferLoop(u32* &data) {
 		data   += ret;
 		pSize  -= ret;
 	}
+
+	if (nVif[idx].recording) dVifPacketClose<idx>(start, data);
 }
 
 _vifT static __fi bool vifTransfer(u32 *data, int size, bool TTE) {
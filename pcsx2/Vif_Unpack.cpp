@@ -19,68 +19,90 @@
 #include "Vif_Dma.h"
 #include "MTVU.h"
 
-enum UnpackOffset {
-	OFFSET_X = 0,
-	OFFSET_Y = 1,
-	OFFSET_Z = 2,
-	OFFSET_W = 3
-};
+// Unpacks are done a full quadword at a time: the data of one write cycle is expanded to
+// the 4 fields (X,Y,Z,W) of a vector, and then merged with the row/col registers and the
+// current VU memory contents according to the mask and mode.  SSE2 only, like the rest of
+// the core.
+
+// Sign or zero extends the low 8/16 bit elements of the vector to 32 bits.
+template< class T > static __fi __m128i vifExtend(__m128i v);
+template<> __fi __m128i vifExtend<u32>(__m128i v) { return v; }
+template<> __fi __m128i vifExtend<u16>(__m128i v) { return _mm_unpacklo_epi16(v, _mm_setzero_si128()); }
+template<> __fi __m128i vifExtend<s16>(__m128i v) { return _mm_srai_epi32(_mm_unpacklo_epi16(v, v), 16); }
+template<> __fi __m128i vifExtend<u8> (__m128i v) { return vifExtend<u16>(_mm_unpacklo_epi8(v, _mm_setzero_si128())); }
+template<> __fi __m128i vifExtend<s8> (__m128i v) {
+	v = _mm_unpacklo_epi8(v, v);
+	return _mm_srai_epi32(_mm_unpacklo_epi16(v, v), 24);
+}
 
-static __fi u32 setVifRow(vifStruct& vif, u32 reg, u32 data) {
-	vif.MaskRow._u32[reg] = data;
-	return data;
+// Loads the first n elements of src into the low part of the vector.
+template< uint n, class T >
+static __fi __m128i vifLoad(const T* src) {
+	switch (n * sizeof(T)) {
+		case 2:  return _mm_cvtsi32_si128(*(u16*)src);
+		case 4:  return _mm_cvtsi32_si128(*(u32*)src);
+		case 8:  return _mm_loadl_epi64((__m128i*)src);
+		default: return _mm_loadu_si128((__m128i*)src);
+	}
 }
 
 // cycle derives from vif.cl
 // mode derives from vifRegs.mode
 template< uint idx, uint mode, bool doMask >
-static __ri void writeXYZW(u32 offnum, u32 &dest, u32 data) {
-	int n = 0;
-
+static __fi void writeXYZW(u32* dest, __m128i data) {
 	vifStruct& vif = MTVU_VifX;
 
-	if (doMask) {
-		const VIFregisters& regs = MTVU_VifXRegs;
-		switch (vif.cl) {
-			case 0:  n = (regs.mask >> (offnum * 2)) & 0x3;		break;
-			case 1:  n = (regs.mask >> ( 8 + (offnum * 2))) & 0x3;	break;
-			case 2:  n = (regs.mask >> (16 + (offnum * 2))) & 0x3;	break;
-			default: n = (regs.mask >> (24 + (offnum * 2))) & 0x3;	break;
-		}
+	const __m128i row = _mm_load_si128((__m128i*)&vif.MaskRow);
+
+	if (mode == 1 || mode == 2) data = _mm_add_epi32(data, row);
+
+	if (!doMask) {
+		if (mode >= 2) _mm_store_si128((__m128i*)&vif.MaskRow, data);
+		_mm_storeu_si128((__m128i*)dest, data);
+		return;
 	}
 
-	// Four possible types of masking are handled below:
+	// Four possible types of masking per field:
 	//   0 - Data
 	//   1 - MaskRow
 	//   2 - MaskCol
 	//   3 - Write protect
-
-	switch (n) {
-		case 0:
-			switch (mode) {
-				case 1:  dest = data + vif.MaskRow._u32[offnum]; break;
-				case 2:  dest = setVifRow(vif, offnum, vif.MaskRow._u32[offnum] + data); break;
-				case 3:  dest = setVifRow(vif, offnum, data); break;
-				default: dest = data; break;
-			}
-			break;
-		case 1: dest = vif.MaskRow._u32[offnum]; break;
-		case 2: dest = vif.MaskCol._u32[std::min(vif.cl,3)]; break;
-		case 3: break;
-	}
+	//
+	// The 2 bit field of each lane gets moved in place with a multiply, since SSE2 has
+	// no per lane shifts.
+	const VIFregisters& regs = MTVU_VifXRegs;
+	const int cl = std::min(vif.cl, 3);
+	const u32 m  = (regs.mask >> (cl * 8)) & 0xff;
+
+	__m128i n = _mm_mullo_epi16(_mm_set1_epi32(m), _mm_setr_epi32(1 << 6, 1 << 4, 1 << 2, 1));
+	n = _mm_and_si128(_mm_srli_epi32(n, 6), _mm_set1_epi32(3));
+
+	const __m128i isData = _mm_cmpeq_epi32(n, _mm_setzero_si128());
+	const __m128i isRow  = _mm_cmpeq_epi32(n, _mm_set1_epi32(1));
+	const __m128i isCol  = _mm_cmpeq_epi32(n, _mm_set1_epi32(2));
+	const __m128i isProt = _mm_cmpeq_epi32(n, _mm_set1_epi32(3));
+
+	const __m128i col = _mm_set1_epi32(vif.MaskCol._u32[cl]);
+	const __m128i old = _mm_loadu_si128((__m128i*)dest);
+
+	__m128i out = _mm_and_si128(isData, data);
+	out = _mm_or_si128(out, _mm_and_si128(isRow,  row));
+	out = _mm_or_si128(out, _mm_and_si128(isCol,  col));
+	out = _mm_or_si128(out, _mm_and_si128(isProt, old));
+
+	// Only the unmasked fields update the row
+	if (mode >= 2)
+		_mm_store_si128((__m128i*)&vif.MaskRow, _mm_or_si128(_mm_and_si128(isData, data), _mm_andnot_si128(isData, row)));
+
+	_mm_storeu_si128((__m128i*)dest, out);
 }
 #define tParam idx,mode,doMask
 
 template < uint idx, uint mode, bool doMask, class T >
 static void __fastcall UNPACK_S(u32* dest, const T* src)
 {
-	u32 data = *src;
-
 	//S-# will always be a complete packet, no matter what. So we can skip the offset bits
-	writeXYZW<tParam>(OFFSET_X, *(dest+0), data);
-	writeXYZW<tParam>(OFFSET_Y, *(dest+1), data);
-	writeXYZW<tParam>(OFFSET_Z, *(dest+2), data);
-	writeXYZW<tParam>(OFFSET_W, *(dest+3), data);
+	writeXYZW<tParam>(dest, _mm_set1_epi32((u32)*src));
 }
 
 // The PS2 console actually writes v1v0v1v0 for all V2 unpacks -- the second v1v0 pair
@@ -88,10 +110,8 @@ static void __fastcall UNPACK_S(u32* dest, const T* src)
 template < uint idx, uint mode, bool doMask, class T >
 static void __fastcall UNPACK_V2(u32* dest, const T* src)
 {
-	writeXYZW<tParam>(OFFSET_X, *(dest+0), *(src+0));
-	writeXYZW<tParam>(OFFSET_Y, *(dest+1), *(src+1));
-	writeXYZW<tParam>(OFFSET_Z, *(dest+2), *(src+0));
-	writeXYZW<tParam>(OFFSET_W, *(dest+3), *(src+1));
+	const __m128i data = vifExtend<T>(vifLoad<2>(src));
+	writeXYZW<tParam>(dest, _mm_shuffle_epi32(data, _MM_SHUFFLE(1, 0, 1, 0)));
 }
 
 // V3 and V4 unpacks both use the V4 unpack logic, even though most of the OFFSET_W fields
@@ -100,22 +120,19 @@ static void __fastcall UNPACK_V2(u32* dest, const T* src)
 template < uint idx, uint mode, bool doMask, class T >
 static void __fastcall UNPACK_V4(u32* dest, const T* src)
 {
-	writeXYZW<tParam>(OFFSET_X, *(dest+0), *(src+0));
-	writeXYZW<tParam>(OFFSET_Y, *(dest+1), *(src+1));
-	writeXYZW<tParam>(OFFSET_Z, *(dest+2), *(src+2));
-	writeXYZW<tParam>(OFFSET_W, *(dest+3), *(src+3));
+	writeXYZW<tParam>(dest, vifExtend<T>(vifLoad<4>(src)));
 }
 
 // V4_5 unpacks do not support the MODE register, and act as mode==0 always.
+// Each 5 bit field is masked and then shifted in place: left by 3 for X, and right
+// by 2, 7 and 8 for Y, Z and W (done as a multiply and a common right shift).
 template< uint idx, bool doMask >
 static void __fastcall UNPACK_V4_5(u32 *dest, const u32* src)
 {
-	u32 data = *src;
+	__m128i data = _mm_and_si128(_mm_set1_epi32(*src), _mm_setr_epi32(0x001f, 0x03e0, 0x7c00, 0x8000));
+	data = _mm_srli_epi32(_mm_mullo_epi16(data, _mm_setr_epi32(1 << 11, 1 << 6, 1 << 1, 1)), 8);
 
-	writeXYZW<idx,0,doMask>(OFFSET_X, *(dest+0),	((data & 0x001f) << 3));
-	writeXYZW<idx,0,doMask>(OFFSET_Y, *(dest+1),	((data & 0x03e0) >> 2));
-	writeXYZW<idx,0,doMask>(OFFSET_Z, *(dest+2),	((data & 0x7c00) >> 7));
-	writeXYZW<idx,0,doMask>(OFFSET_W, *(dest+3),	((data & 0x8000) >> 8));
+	writeXYZW<idx,0,doMask>(dest, data);
 }
 
 // =====================================================================================================
@@ -276,6 +276,13 @@ static int loadGameSettings(Pcsx2Config& dest, const Game_Data& game) {
 		gf++;
 	}
 
+	if (game.keyExists("hwPollSpeedHack")) {
+		bool hwPollHack = game.getInt("hwPollSpeedHack") ? 1 : 0;
+		PatchesCon->WriteLn("(GameDB) Changing hw register polling speed hack [mode=%d]", hwPollHack);
+		dest.Speedhacks.hwPoll = hwPollHack;
+		gf++;
+	}
+
 	for( GamefixId id=GamefixId_FIRST; id<pxEnumEnd; ++id )
 	{
 		wxString key( EnumToString(id) );
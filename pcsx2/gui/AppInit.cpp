@@ -19,6 +19,8 @@
 #include "ConsoleLogger.h"
 #include "MSWstuff.h"
 #include "MTVU.h" // for thread cancellation on shutdown
+#include "IPU/IPU_Thread.h"
+#include "MTIOP.h"
 
 #include "Utilities/IniInterface.h"
 #include "DebugTools/Debug.h"
@@ -778,6 +780,9 @@ Pcsx2App::~Pcsx2App()
 	pxDoAssert = pxAssertImpl_LogIt;	
 	try {
 		vu1Thread.Cancel();
+		vu0Thread.Cancel();
+		ipuThread.Cancel();
+		iopThread.Cancel();
 	}
 	DESTRUCTOR_CATCHALL
 }
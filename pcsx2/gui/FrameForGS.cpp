@@ -688,6 +688,20 @@ void GSFrame::OnUpdateTitle( wxTimerEvent& evt )
 		pxNonReleaseCode(OSDmonitor(Color_StrongGreen, "UI:", std::to_string(m_CpuUsage.GetGuiPct()).c_str()));
 	}
 
+	if (IsDevBuild) {
+		const MTGS_Stats stats = GetMTGS().GetStats();
+		if (stats.Period > 0) {
+			std::ostringstream mtgs;
+			mtgs << std::fixed << std::setprecision(1)
+				<< "EE stall " << stats.EEStallTime << "ms, GS idle " << stats.GSIdleTime
+				<< "ms, queued " << std::setprecision(2) << stats.QueuedFrames;
+			OSDmonitor(Color_StrongGreen, "MTGS:", mtgs.str());
+		}
+
+		if (EmuConfig.Speedhacks.WaitLoop)
+			OSDmonitor(Color_StrongGreen, "EE idle:", std::to_string(g_eeIdleCyclesFrame / 1000) + "k cycles");
+	}
+
 	std::ostringstream out;
 	out << std::fixed << std::setprecision(2) << fps;
 	OSDmonitor(Color_StrongGreen, "FPS:", out.str());
@@ -342,6 +342,9 @@ namespace Panels
 		pxCheckBox*		m_check_fastCDVD;
 		pxCheckBox*		m_check_vuFlagHack;
 		pxCheckBox*		m_check_vuThread;
+		pxCheckBox*		m_check_vu0Thread;
+		pxCheckBox*		m_check_ipuThread;
+		pxCheckBox*		m_check_iopThread;
 
 	public:
 		virtual ~SpeedHacksPanel() = default;
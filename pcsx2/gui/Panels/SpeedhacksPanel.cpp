@@ -176,12 +176,18 @@ Panels::SpeedHacksPanel::SpeedHacksPanel( wxWindow* parent )
 	m_check_vuThread = new pxCheckBox( vuHacksPanel, _("MTVU (Multi-Threaded microVU1)"),
 		_("Good Speedup and High Compatibility; may cause hanging... [Recommended if 3+ cores]") );
 
+	m_check_vu0Thread = new pxCheckBox( vuHacksPanel, _("MTVU0 (Multi-Threaded microVU0)"),
+		_("Speedup for games using VU0 micro programs heavily. Experimental, may break VU0 timing sensitive games.") );
+
 	m_check_vuFlagHack->SetToolTip( pxEt( L"Updates Status Flags only on blocks which will read them, instead of all the time. This is safe most of the time, and Super VU does something similar by default."
 	) );
 
 	m_check_vuThread->SetToolTip( pxEt( L"Runs VU1 on its own thread (microVU1-only). Generally a speedup on CPUs with 3 or more cores. This is safe for most games, but a few games are incompatible and may hang. In the case of GS limited games, it may be a slowdown (especially on dual core CPUs)."
 	) );
 
+	m_check_vu0Thread->SetToolTip( pxEt( L"Runs VU0 micro programs on their own thread (microVU0-only), overlapped with the EE code that follows the call. The EE waits for VU0 when it next uses COP2, LQC2/SQC2 or VU0 memory, so VU0 programs appear to finish at that point, which changes timings slightly."
+	) );
+
 	// ------------------------------------------------------------------------
 	// All other hacks Section:
 
@@ -196,6 +202,12 @@ Panels::SpeedHacksPanel::SpeedHacksPanel( wxWindow* parent )
 	m_check_fastCDVD = new pxCheckBox( miscHacksPanel, _("Enable fast CDVD"),
 		_("Fast disc access, less loading times. [Not Recommended]") );
 
+	m_check_ipuThread = new pxCheckBox( miscHacksPanel, _("MTIPU (Multi-Threaded IPU)"),
+		_("Speedup for FMVs on CPUs with 3 or more cores.") );
+
+	m_check_iopThread = new pxCheckBox( miscHacksPanel, _("MTIOP (Multi-Threaded IOP)"),
+		_("Runs the IOP on its own thread. Experimental, may break SIF timing sensitive games.") );
+
 
 	m_check_intc->SetToolTip( pxEt( L"This hack works best for games that use the INTC Status register to wait for vsyncs, which includes primarily non-3D RPG titles. Games that do not use this method of vsync will see little or no speedup from this hack."
 	) );
@@ -206,6 +218,12 @@ Panels::SpeedHacksPanel::SpeedHacksPanel( wxWindow* parent )
 	m_check_fastCDVD->SetToolTip( pxEt( L"Check HDLoader compatibility lists for known games that have issues with this (often marked as needing 'mode 1' or 'slow DVD')."
 	) );
 
+	m_check_ipuThread->SetToolTip( pxEt( L"Decodes MPEG macroblocks on their own thread while the EE keeps running. The EE only waits when it reads IPU results that aren't ready yet, so FMVs that were limited by the EE thread run faster."
+	) );
+
+	m_check_iopThread->SetToolTip( pxEt( L"Executes the IOP timeslices on a separate thread, overlapped with the EE code that runs until the next event test. The EE waits for the IOP at SIF transfers, SBUS register accesses and event tests. SIF transfers started by the IOP are delayed until that point, which changes timings slightly."
+	) );
+
 	// ------------------------------------------------------------------------
 	//  Layout and Size ---> (!!)
 
@@ -225,11 +243,14 @@ Panels::SpeedHacksPanel::SpeedHacksPanel( wxWindow* parent )
 
 	*vuHacksPanel += m_check_vuFlagHack | StdExpand();
 	*vuHacksPanel += m_check_vuThread | StdExpand();
+	*vuHacksPanel += m_check_vu0Thread | StdExpand();
 	//*vuHacksPanel	+= 57; // Aligns left and right boxes in default language and font size
 
 	*miscHacksPanel	+= m_check_intc | StdExpand();
 	*miscHacksPanel	+= m_check_waitloop | StdExpand();
 	*miscHacksPanel	+= m_check_fastCDVD | StdExpand();
+	*miscHacksPanel	+= m_check_ipuThread | StdExpand();
+	*miscHacksPanel	+= m_check_iopThread | StdExpand();
 
 	*left	+= m_eeRateSliderPanel | StdExpand();
 	*left	+= miscHacksPanel	| StdExpand();
@@ -281,6 +302,9 @@ void Panels::SpeedHacksPanel::EnableStuff( AppConfig* configToUse )
 	m_check_intc->Enable(HacksEnabledAndNoPreset);
 	m_check_waitloop->Enable(HacksEnabledAndNoPreset);
 	m_check_fastCDVD->Enable(HacksEnabledAndNoPreset);
+	m_check_ipuThread->Enable(HacksEnabledAndNoPreset);
+	m_check_iopThread->Enable(HacksEnabledAndNoPreset);
+	m_check_vu0Thread->Enable(HacksEnabledAndNoPreset);
 
 	// Grayout MTVU on safest preset
 	m_check_vuThread->Enable(hacksEnabled && (!hasPreset || configToUse->PresetIndex != 0));
@@ -315,6 +339,9 @@ void Panels::SpeedHacksPanel::ApplyConfigToGui( AppConfig& configToApply, int fl
 	m_check_waitloop->SetValue(opts.WaitLoop);
 	m_check_fastCDVD->SetValue(opts.fastCDVD);
 	m_check_vuThread->SetValue(opts.vuThread);
+	m_check_ipuThread->SetValue(opts.ipuThread);
+	m_check_iopThread->SetValue(opts.iopThread);
+	m_check_vu0Thread->SetValue(opts.vu0Thread);
 		
 
 	// Then, lock(gray out)/unlock the widgets as necessary.
@@ -339,6 +366,9 @@ void Panels::SpeedHacksPanel::Apply()
 	opts.IntcStat			= m_check_intc->GetValue();
 	opts.vuFlagHack			= m_check_vuFlagHack->GetValue();
 	opts.vuThread			= m_check_vuThread->GetValue();
+	opts.ipuThread			= m_check_ipuThread->GetValue();
+	opts.iopThread			= m_check_iopThread->GetValue();
+	opts.vu0Thread			= m_check_vu0Thread->GetValue();
 
 	// If the user has a command line override specified, we need to disable it
 	// so that their changes take effect
@@ -61,6 +61,35 @@ template<uint page> extern void __fastcall hwWrite32 (u32 mem, mem32_t value);
 template<uint page> extern void __fastcall hwWrite64 (u32 mem, const mem64_t* srcval);
 template<uint page> extern void __fastcall hwWrite128(u32 mem, const mem128_t* srcval);
 
+// --------------------------------------------------------------------------------------
+//  Hardware register polling  (hwPoll speedhack)
+// --------------------------------------------------------------------------------------
+// Some games wait on DMAC/VIF/GIF status bits by reading the register in a tight loop.  Such
+// a register can't change before the next scheduled event (transfers complete through one),
+// so once the same read from the same loop has returned the same value a few times in a row,
+// the EE is fast-forwarded to the next event, like the INTC_STAT hack does.  Any register
+// write breaks the pattern.  Writes to memory done by the loop aren't seen, and loops that
+// also count iterations (timeouts) see them go by much faster, hence GameDB only.
+
+struct HwPollState
+{
+	u32		mem;
+	u32		pc;
+	u32		value;
+	u32		cycle;		// cpuRegs.cycle of the last read
+	uint	count;		// identical reads in a row
+};
+
+extern HwPollState hwPoll;
+
+extern void hwPollCheck(u32 mem, u32 value);
+
+// Counters are time based and the IPU moves on its own, so only the GIF/VIF and DMAC pages
+// are watched.  INTC_STAT has its own hack.
+static __fi bool hwPollPage(uint page) { return page == 0x03 || (page >= 0x08 && page <= 0x0e); }
+
+static __fi void hwPollBreak() { hwPoll.count = 0; }
+
 // --------------------------------------------------------------------------------------
 //  Hardware FIFOs (128 bit access only!)
 // --------------------------------------------------------------------------------------
@@ -19,6 +19,7 @@
 
 #include "IopCommon.h"
 #include "Sif.h"
+#include "MTIOP.h"
 
 _sif sif2;
 
@@ -352,7 +353,11 @@ __fi void  sif2Interrupt()
 {
 	if (!sif2.iop.end || sif2.iop.counter > 0)
 	{
-		SIF2Dma();
+		// The transfer also drives the EE side of the SIF, leave it to the EE thread.
+		if (iopThread.IsSelf())
+			iopThread.PostEvent(IOP_EVENT_SIF2);
+		else
+			SIF2Dma();
 		return;
 	}
 	
@@ -369,6 +374,8 @@ __fi void  EEsif2Interrupt()
 
 __fi void dmaSIF2()
 {
+	iopThread.Wait();
+
 	DevCon.Warning("SIF2 EE CHCR %x", sif2dma.chcr._u32);
 	SIF_LOG(wxString(L"dmaSIF2" + sif2dma.cmqt_to_str()).To8BitData());
 
@@ -30,6 +30,8 @@ __tls_emit u32 *j32Ptr[32];
 u16 g_x86AllocCounter = 0;
 u16 g_xmmAllocCounter = 0;
 
+Threading::Mutex g_recCompileLock;
+
 EEINST* g_pCurInstInfo = NULL;
 
 // used to make sure regs don't get changed while in recompiler
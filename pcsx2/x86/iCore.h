@@ -17,6 +17,7 @@
 #define _PCSX2_CORE_RECOMPILER_
 
 #include "x86emitter/x86emitter.h"
+#include "Utilities/Threading.h"
 #include "VUmicro.h"
 
 // Namespace Note : iCore32 contains all of the Register Allocation logic, in addition to a handful
@@ -261,6 +262,10 @@ extern __tls_emit u32 *j32Ptr[32];		// depreciated item.  use local u32* vars in
 extern u16 g_x86AllocCounter;
 extern u16 g_xmmAllocCounter;
 
+// The EE and IOP recompilers share the allocator state above.  With the threaded IOP they
+// recompile on different threads, and hold this lock while they do.
+extern Threading::Mutex g_recCompileLock;
+
 // allocates only if later insts use XMM, otherwise checks
 int _allocCheckGPRtoXMM(EEINST* pinst, int gprreg, int mode);
 int _allocCheckFPUtoXMM(EEINST* pinst, int fpureg, int mode);
@@ -1074,6 +1074,8 @@ static void __fastcall iopRecRecompile( const u32 startpc )
 	u32 i;
 	u32 willbranch3 = 0;
 
+	Threading::ScopedLock lock( THREAD_IOP ? &g_recCompileLock : NULL );
+
 	// Inject IRX hack
 	if (startpc == 0x1630 && g_Conf->CurrentIRX.Length() > 3) {
 		if (iopMemRead32(0x20018) == 0x1F) {
@@ -73,6 +73,7 @@ void SetBranchImm( u32 imm );
 void iFlushCall(int flushtype);
 void recBranchCall( void (*func)() );
 void recCall( void (*func)() );
+void recVU0ThreadSync();
 
 namespace R5900{
 namespace Dynarec {
@@ -33,6 +33,7 @@
 #include "Elfheader.h"
 
 #include "../DebugTools/Breakpoints.h"
+#include "../DebugTools/MIPSAnalyst.h"
 #include "Patch.h"
 
 #if !PCSX2_SEH
@@ -1034,6 +1035,9 @@ static void iBranchTest(u32 newpc)
 		xADD(ptr32[&cpuRegs.cycle], scaleblockcycles());
 		xCMP(eax, ptr32[&cpuRegs.cycle]);
 		xCMOVS(eax, ptr32[&cpuRegs.cycle]);
+		xMOV(edx, eax);
+		xSUB(edx, ptr32[&cpuRegs.cycle]);
+		xADD(ptr32[&g_eeIdleCycles], edx);
 		xMOV(ptr32[&cpuRegs.cycle], eax);
 
 		xJMP( (void*)DispatcherEvent );
@@ -1615,6 +1619,8 @@ static void __fastcall recRecompile( const u32 startpc )
 	u32 willbranch3 = 0;
 	u32 usecop2;
 
+	ScopedLock lock( THREAD_IOP ? &g_recCompileLock : NULL );
+
 #ifdef PCSX2_DEBUG
     if (dumplog & 4) iDumpRegisters(startpc, 0);
 #endif
@@ -1843,85 +1849,12 @@ static void __fastcall recRecompile( const u32 startpc )
 
 StartRecomp:
 
-	// The idea here is that as long as a loop doesn't write to a register it's already read
-	// (excepting registers initialised with constants or memory loads) or use any instructions
-	// which alter the machine state apart from registers, it will do the same thing on every
-	// iteration.
-	// TODO: special handling for counting loops.  God of war wastes time in a loop which just
-	// counts to some large number and does nothing else, many other games use a counter as a
-	// timeout on a register read.  AFAICS the only way to optimise this for non-const cases
-	// without a significant loss in cycle accuracy is with a division, but games would probably
-	// be happy with time wasting loops completing in 0 cycles and timeouts waiting forever.
+	// Loops that do the same thing on every iteration (see MIPSAnalyst::IsIdleLoop) are
+	// fast-forwarded to the next event by iBranchTest.  Small loops made of several blocks
+	// (forward branches inside the loop) are checked from the block with the branch back.
 	s_nBlockFF = false;
-	if (s_branchTo == startpc) {
-		s_nBlockFF = true;
-
-		u32 reads = 0, loads = 1;
-
-		for (i = startpc; i < s_nEndBlock; i += 4) {
-			if (i == s_nEndBlock - 8)
-				continue;
-			cpuRegs.code = *(u32*)PSM(i);
-			// nop
-			if (cpuRegs.code == 0)
-				continue;
-			// cache, sync
-			else if (_Opcode_ == 057 || _Opcode_ == 0 && _Funct_ == 017)
-				continue;
-			// imm arithmetic
-			else if ((_Opcode_ & 070) == 010 || (_Opcode_ & 076) == 030)
-			{
-				if (loads & 1 << _Rs_) {
-					loads |= 1 << _Rt_;
-					continue;
-				}
-				else
-					reads |= 1 << _Rs_;
-				if (reads & 1 << _Rt_) {
-					s_nBlockFF = false;
-					break;
-				}
-			}
-			// common register arithmetic instructions
-			else if (_Opcode_ == 0 && (_Funct_ & 060) == 040 && (_Funct_ & 076) != 050)
-			{
-				if (loads & 1 << _Rs_ && loads & 1 << _Rt_) {
-					loads |= 1 << _Rd_;
-					continue;
-				}
-				else
-					reads |= 1 << _Rs_ | 1 << _Rt_;
-				if (reads & 1 << _Rd_) {
-					s_nBlockFF = false;
-					break;
-				}
-			}
-			// loads
-			else if ((_Opcode_ & 070) == 040 || (_Opcode_ & 076) == 032 || _Opcode_ == 067)
-			{
-				if (loads & 1 << _Rs_) {
-					loads |= 1 << _Rt_;
-					continue;
-				}
-				else
-					reads |= 1 << _Rs_;
-				if (reads & 1 << _Rt_) {
-					s_nBlockFF = false;
-					break;
-				}
-			}
-			// mfc*, cfc*
-			else if ((_Opcode_ & 074) == 020 && _Rs_ < 4)
-			{
-				loads |= 1 << _Rt_;
-			}
-			else
-			{
-				s_nBlockFF = false;
-				break;
-			}
-		}
-	}
+	if (s_branchTo == startpc || (s_branchTo < startpc && s_nEndBlock - s_branchTo <= MIPSAnalyst::IdleLoopMaxSize))
+		s_nBlockFF = MIPSAnalyst::IsIdleLoop(s_branchTo, s_nEndBlock);
 
 	// rec info //
 	{
@@ -20,6 +20,7 @@
 #include "R5900OpcodeTables.h"
 #include "iR5900LoadStore.h"
 #include "iR5900.h"
+#include "VUmicro.h"
 
 using namespace x86Emitter;
 
@@ -577,6 +578,8 @@ void recLQC2()
 	_deleteVFtoXMMreg(_Ft_, 0, 2);
 #endif
 
+	if (THREAD_VU0) recVU0ThreadSync(); // Join the VU0 thread before touching its registers
+
 	if (_Rt_)
 		xMOV(edx, (uptr)&VU0.VF[_Ft_].UD[0]);
 	else
@@ -610,6 +613,8 @@ void recSQC2()
 	_deleteVFtoXMMreg(_Ft_, 0, 1); //Want to flush it but not clear it
 #endif
 
+	if (THREAD_VU0) recVU0ThreadSync(); // Join the VU0 thread before touching its registers
+
 	xMOV(edx, (uptr)&VU0.VF[_Ft_].UD[0]);
 
 	if (GPR_IS_CONST1(_Rs_))
@@ -328,8 +328,10 @@ void recMicroVU1::Reserve() {
 }
 
 void recMicroVU0::Shutdown() noexcept {
-	if (m_Reserved.exchange(0) == 1)
+	if (m_Reserved.exchange(0) == 1) {
+		vu0Thread.WaitVU();
 		mVUclose(microVU0);
+	}
 }
 void recMicroVU1::Shutdown() noexcept {
 	if (m_Reserved.exchange(0) == 1) {
@@ -340,6 +342,7 @@ void recMicroVU1::Shutdown() noexcept {
 
 void recMicroVU0::Reset() {
 	if(!pxAssertDev(m_Reserved, "MicroVU0 CPU Provider has not been reserved prior to reset!")) return;
+	vu0Thread.WaitVU();
 	mVUreset(microVU0, true);
 }
 void recMicroVU1::Reset() {
@@ -358,7 +361,8 @@ void recMicroVU0::Execute(u32 cycles) {
 	// Edit: Need to test this again, if anyone ever has a "Woody" game :p
 	((mVUrecCall)microVU0.startFunct)(VU0.VI[REG_TPC].UL, cycles);
 
-	if(microVU0.regs().flags & 0x4)
+	// The threaded VU0 leaves the interrupt to the EE, see VU0_Thread::WaitVU()
+	if(!THREAD_VU0 && (microVU0.regs().flags & 0x4))
 	{
 		microVU0.regs().flags &= ~0x4;
 		hwIntcIrq(6);
@@ -381,6 +385,7 @@ void recMicroVU1::Execute(u32 cycles) {
 
 void recMicroVU0::Clear(u32 addr, u32 size) {
 	pxAssert(m_Reserved); // please allocate me first! :|
+	vu0Thread.WaitVU();
 	mVUclear(microVU0, addr, size);
 }
 void recMicroVU1::Clear(u32 addr, u32 size) {
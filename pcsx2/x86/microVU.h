@@ -226,6 +226,10 @@ struct microVU {
 	__fi VIFregisters& getVifRegs()	const {
 		return (index && THREAD_VU1) ? vu1Thread.vifRegs : regs().GetVifRegs();
 	}
+	// The threaded VU0 keeps its VPU_STAT bits aside for the EE to merge them (see VU0_Thread)
+	__fi u32& getVpuStat() const {
+		return (!index && THREAD_VU0) ? vu0Thread.vpuStat : VU0.VI[REG_VPU_STAT].UL;
+	}
 };
 
 // microVU rec structs
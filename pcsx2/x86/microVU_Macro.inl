@@ -460,9 +460,32 @@ void (*recCOP2SPECIAL2t[128])() = {
 	rec_C2UNK,	rec_C2UNK,	rec_C2UNK,	rec_C2UNK,	rec_C2UNK,	rec_C2UNK,	rec_C2UNK,	rec_C2UNK,
 };
 
+// Joins the threaded VU0 (COP2, LQC2/SQC2).  The call is skipped inline when no program is
+// outstanding; it only clobbers the caller saved regs, like a vtlb handler call.
+void recVU0ThreadSync() {
+	iFlushCall(FLUSH_FULLVTLB);
+	xCMP(ptr8[&vu0Thread.outstanding], 0);
+	xForwardJZ8 skip;
+		xFastCall((void*)vu0Finish);
+	skip.SetTarget();
+}
+
+// Macro ops also share microVU0's recompiler state with the VU0 thread, hence the join at
+// recompile time as well.
+static void COP2_ThreadSync() {
+	if (!THREAD_VU0 || !vu0ThreadSyncsOnCOP2(cpuRegs.code)) return;
+	vu0Thread.WaitVU();
+	if (_Rs_ == 6 && _Rd_ == REG_FBRST && _Rt_) { // CTC2, see vu0ThreadFBRST
+		iFlushCall(FLUSH_FULLVTLB);
+		_eeMoveGPRtoR(ecx, _Rt_);
+		xFastCall((void*)vu0ThreadFBRST, ecx);
+	}
+	recVU0ThreadSync();
+}
+
 namespace R5900 {
 namespace Dynarec {
-namespace OpcodeImpl { void recCOP2() { recCOP2t[_Rs_](); }}}}
+namespace OpcodeImpl { void recCOP2() { COP2_ThreadSync(); recCOP2t[_Rs_](); }}}}
 void recCOP2_BC2  () { recCOP2_BC2t[_Rt_](); }
 void recCOP2_SPEC1() { recCOP2SPECIAL1t[_Funct_](); }
 void recCOP2_SPEC2() { recCOP2SPECIAL2t[(cpuRegs.code&3)|((cpuRegs.code>>4)&0x7c)](); }
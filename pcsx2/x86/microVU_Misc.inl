@@ -273,6 +273,13 @@ static void __fc mVUwaitMTVU() {
 	vu1Thread.WaitVU();
 }
 
+// Same for micro programs running on the VU0 thread, which mustn't use the EE side of the
+// VU1 ring.
+static void __fc mVUwaitMTVUfromVU0() {
+	if (IsDevBuild) DevCon.WriteLn("microVU0: VU0 thread waiting on VU1 thread to access VU1 regs!");
+	vu1Thread.WaitVUFromVU0();
+}
+
 // Transforms the Address in gprReg to valid VU0/VU1 Address
 __fi void mVUaddrFix(mV, const x32& gprReg)
 {
@@ -300,7 +307,7 @@ __fi void mVUaddrFix(mV, const x32& gprReg)
 					xMOV(gprT3, xPC);               // So we don't spam console, we'll only check micro-mode...
 					xCALL((void*)mVUwarningRegAccess);
 				}
-				xCALL((void*)mVUwaitMTVU);
+				xCALL((void*)((isCOP2 || !THREAD_VU0) ? mVUwaitMTVU : mVUwaitMTVUfromVU0));
 #ifdef __GNUC__
 				xADD(esp, 4);
 #endif
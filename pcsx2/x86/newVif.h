@@ -39,6 +39,9 @@ extern void  VifUnpackSSE_Init();
 extern void  VifUnpackSSE_Destroy();
 
 _vifT extern void  dVifUnpack  (const u8* data, bool isFill);
+_vifT extern void  dVifPacketReplay(u32* &data);
+_vifT extern void  dVifPacketCode  (const u32* start, const u32* data);
+_vifT extern void  dVifPacketClose (const u32* start, const u32* data);
 
 #define VUFT VIFUnpackFuncTable
 #define	_v0 0
@@ -52,6 +55,33 @@ _vifT extern void  dVifUnpack  (const u8* data, bool isFill);
 #define xmmRow  xmm6
 #define xmmTemp xmm7
 
+// nVifPacket - The leading UNPACK/STCYCL/STMASK/STMOD/NOP codes of a vif packet, recorded
+// the first time the packet is transferred, so that later transfers of the same command
+// stream (per-frame model uploads, mostly) can run their unpack routines back to back
+// without going through vifTransferLoop and the vifBlocks hash.  Anything else (MSCAL,
+// DIRECT, irq bits, ...) ends the recording, and is left to vifTransferLoop as usual.
+struct nVifPacketOp {
+	u32  pos;			// Offset of the vifcode in the packet (in u32's)
+	u32  code;			// VifCode
+	u32  value;			// STMASK data
+	u16  length;		// Unpacks: pre computed length (see nVifBlock)
+	u8   isFill;		// Unpacks: filling write
+	u8   _pad;
+	uptr startPtr;		// Unpacks: RecGen code
+};
+
+static const uint nVifPacketOps   = 48;	// Max codes recorded per packet
+static const uint nVifPacketSlots = 64;	// Direct mapped on the packet size and first code
+
+struct nVifPacket {
+	u32 size;			// Size of the whole packet (in u32's), 0 if the slot is empty
+	u32 length;			// Size of the recorded part of the packet (in u32's)
+	u32 mask;			// VIF registers the packet was recorded with
+	u8  cl, wl, mode;
+	u8  numOps;
+	nVifPacketOp ops[nVifPacketOps];
+};
+
 struct nVifStruct {
 	// Buffer for partial transfers (should always be first to ensure alignment)
 	// Maximum buffer size is 256 (vifRegs.Num max range) * 16 (quadword)
@@ -67,6 +97,9 @@ struct nVifStruct {
 
 	HashBucket				vifBlocks;		// Vif Blocks
 
+	nVifPacket				packets[nVifPacketSlots];	// Recorded Vif packets
+	nVifPacket*				recording;		// Packet being recorded, or NULL
+
 	nVifStruct() = default;
 };
 
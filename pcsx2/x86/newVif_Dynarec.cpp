@@ -28,6 +28,11 @@ static void recReset(int idx) {
 	nVif[idx].recReserve->Reset();
 
 	nVif[idx].recWritePtr = nVif[idx].recReserve->GetPtr();
+
+	// Recorded packets point into the code cache as well
+	for (uint i = 0; i < nVifPacketSlots; i++)
+		nVif[idx].packets[i].size = 0;
+	nVif[idx].recording = NULL;
 }
 
 void dVifReserve(int idx) {
@@ -298,6 +303,25 @@ _vifT __fi nVifBlock* dVifCompile(nVifBlock& block, bool isFill) {
 	return &block;
 }
 
+_vifT static __fi void dVifExecute(uptr startPtr, uint length, const u8* data, bool isFill) {
+	const VURegs& VU         = vuRegs[idx];
+	vifStruct&    vif        = MTVU_VifX;
+	VIFregisters& vifRegs    = MTVU_VifXRegs;
+	const uint    vuMemLimit = idx ? 0x4000 : 0x1000;
+
+	u8*  startmem = VU.Mem + (vif.tag.addr & (vuMemLimit-0x10));
+	u8*  endmem   = VU.Mem + vuMemLimit;
+
+	if (likely((startmem + length) <= endmem)) {
+		// No wrapping, you can run the fast dynarec
+		((nVifrecCall)startPtr)((uptr)startmem, (uptr)data);
+	} else {
+		VIF_LOG("Running Interpreter Block: nVif%x - VU Mem Ptr Overflow; falling back to interpreter. Start = %x num = %x, wl = %x, cl = %x",
+				idx, vif.tag.addr, vifRegs.num, vifRegs.cycle.wl, vifRegs.cycle.cl);
+		_nVifUnpack(idx, data, vifRegs.mode, isFill);
+	}
+}
+
 _vifT __fi void dVifUnpack(const u8* data, bool isFill) {
 
 	nVifStruct&   v       = nVif[idx];
@@ -341,23 +365,154 @@ _vifT __fi void dVifUnpack(const u8* data, bool isFill) {
 		b = dVifCompile<idx>(block, isFill);
 	}
 
-	{ // Execute the block
-		const VURegs& VU         = vuRegs[idx];
-		const uint    vuMemLimit = idx ? 0x4000 : 0x1000;
+	if (v.recording) { // Remember the block for the packet being recorded
+		nVifPacketOp& op = v.recording->ops[v.recording->numOps - 1];
+		op.startPtr = b->startPtr;
+		op.length   = b->length;
+		op.isFill   = isFill;
+	}
+
+	dVifExecute<idx>(b->startPtr, b->length, data, isFill);
+}
+
+template void dVifUnpack<0>(const u8* data, bool isFill);
+template void dVifUnpack<1>(const u8* data, bool isFill);
+
+// ----------------------------------------------------------------------------
+//  Vif Packet Cache
+// ----------------------------------------------------------------------------
+// Codes that only depend on the packet itself and on the registers they set, and that
+// can't stall or interrupt the transfer.  Invalid unpack formats go the normal way.
+static __fi bool dVifPacketCodeCached(u32 code) {
+	if (code & 0x80000000) return false; // Irq
+	const uint cmd = (code >> 24) & 0x7f;
+	if ((cmd & 0x60) == 0x60) return nVifT[cmd & 0xf] != 0;
+	return cmd == 0x00 || cmd == 0x01 || cmd == 0x05 || cmd == 0x20;
+}
 
-		u8*  startmem = VU.Mem + (vif.tag.addr & (vuMemLimit-0x10));
-		u8*  endmem   = VU.Mem + vuMemLimit;
+static __fi uint dVifPacketSlot(const u32* data, u32 size) {
+	return (size + (data[0] ^ (data[0] >> 16))) & (nVifPacketSlots - 1);
+}
 
-		if (likely((startmem + b->length) <= endmem)) {
-			// No wrapping, you can run the fast dynarec
-			((nVifrecCall)b->startPtr)((uptr)startmem, (uptr)data);
-		} else {
-			VIF_LOG("Running Interpreter Block: nVif%x - VU Mem Ptr Overflow; falling back to interpreter. Start = %x End = %x num = %x, wl = %x, cl = %x",
-					v.idx, vif.tag.addr, vif.tag.addr + (block.num * 16), block.num, block.wl, block.cl);
-			_nVifUnpack(idx, data, vifRegs.mode, isFill);
+// Runs the recorded codes of the packet if it's been seen before, and advances data
+// past them (vifTransferLoop handles whatever follows).  Else starts recording it.
+_vifT void dVifPacketReplay(u32* &data) {
+	nVifStruct&   v       = nVif[idx];
+	vifStruct&    vifX    = GetVifX;
+	VIFregisters& vifRegs = vifXRegs;
+	const u32     size    = vifX.vifpacketsize;
+
+	if (!size || vifX.cmd || vifX.irq || vifX.vifstalled.enabled || vifX.queued_program || v.bSize) return;
+	if (idx && THREAD_VU1) return;
+	if (IsDevBuild && SysTrace.EE.VIFcode.IsActive()) return;
+
+	nVifPacket& p = v.packets[dVifPacketSlot(data, size)];
+
+	if (p.size != size || p.cl != vifRegs.cycle.cl || p.wl != vifRegs.cycle.wl
+	||  p.mode != vifRegs.mode || p.mask != vifRegs.mask)
+		goto record;
+
+	for (uint i = 0; i < p.numOps; i++) {
+		const nVifPacketOp& op = p.ops[i];
+		if (data[op.pos] != op.code) goto record;
+
+		switch (op.code >> 24) {
+			case 0x00: // Nop followed by MskPath3 breaks the transfer (see vifCode_Nop)
+				if (op.pos + 1 < size && ((data[op.pos + 1] >> 24) & 0x7f) == 0x6 && (data[op.pos + 1] & 0x1))
+					goto record;
+				break;
+			case 0x20:
+				if (data[op.pos + 1] != op.value) goto record;
+				break;
 		}
 	}
+
+	for (uint i = 0; i < p.numOps; i++) {
+		const nVifPacketOp& op = p.ops[i];
+		vifRegs.code = op.code;
+
+		switch (op.code >> 24) {
+			case 0x00: break;
+			case 0x01:
+				vifRegs.cycle.cl = (u8)(op.code);
+				vifRegs.cycle.wl = (u8)(op.code >> 8);
+				break;
+			case 0x05: vifRegs.mode = op.code & 0x3; break;
+			case 0x20: vifRegs.mask = op.value;      break;
+			default:
+				vifX.cmd            = op.code >> 24;
+				vifX.vifpacketsize  = size - op.pos;
+				vifUnpackSetup<idx>(&data[op.pos]);
+				dVifExecute<idx>(op.startPtr, op.length, (u8*)&data[op.pos + 1], op.isFill);
+
+				vifX.pass     = 0;
+				vifX.tag.size = 0;
+				vifX.cmd      = 0;
+				vifRegs.num   = 0;
+				break;
+		}
+	}
+
+	vifX.vifpacketsize = size - p.length;
+	data += p.length;
+	return;
+
+record:
+	p.size   = 0;
+	p.length = 0;
+	p.numOps = 0;
+	p.cl     = vifRegs.cycle.cl;
+	p.wl     = vifRegs.cycle.wl;
+	p.mode   = vifRegs.mode;
+	p.mask   = vifRegs.mask;
+	v.recording = &p;
 }
 
-template void dVifUnpack<0>(const u8* data, bool isFill);
-template void dVifUnpack<1>(const u8* data, bool isFill);
+// Called by vifTransferLoop for each new code of the packet being recorded.
+_vifT void dVifPacketCode(const u32* start, const u32* data) {
+	nVifPacket& p = *nVif[idx].recording;
+
+	if (!dVifPacketCodeCached(data[0]) || p.numOps >= nVifPacketOps) {
+		dVifPacketClose<idx>(start, data);
+		return;
+	}
+
+	nVifPacketOp& op = p.ops[p.numOps++];
+	op.pos      = data - start;
+	op.code     = data[0];
+	op.value    = 0;
+	op.length   = 0;
+	op.isFill   = 0;
+	op.startPtr = 0;
+}
+
+_vifT void dVifPacketClose(const u32* start, const u32* data) {
+	nVifStruct& v = nVif[idx];
+	nVifPacket& p = *v.recording;
+	u32 length    = data - start;
+	v.recording   = NULL;
+
+	// An unfinished code (partial unpack, or the packet ended on STMask) isn't recorded
+	if (p.numOps && GetVifX.cmd)
+		length = p.ops[--p.numOps].pos;
+
+	for (uint i = 0; i < p.numOps; i++) {
+		nVifPacketOp& op = p.ops[i];
+		if ((op.code >> 24) == 0x20)
+			op.value = start[op.pos + 1];
+		else if (((op.code >> 24) & 0x60) == 0x60 && !op.startPtr)
+			return;
+	}
+
+	if (!p.numOps) return;
+
+	p.length = length;
+	p.size   = GetVifX.vifpacketsize + (data - start);
+}
+
+template void dVifPacketReplay<0>(u32* &data);
+template void dVifPacketReplay<1>(u32* &data);
+template void dVifPacketCode<0>(const u32* start, const u32* data);
+template void dVifPacketCode<1>(const u32* start, const u32* data);
+template void dVifPacketClose<0>(const u32* start, const u32* data);
+template void dVifPacketClose<1>(const u32* start, const u32* data);
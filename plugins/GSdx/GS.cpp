@@ -1095,6 +1095,13 @@ EXPORT_C GSReplay(HWND hwnd, HINSTANCE hinst, LPSTR lpszCmdLine, int nCmdShow)
 
 	file->Read(regs.data(), 0x2000);
 
+	// Only frames [start_frame, end_frame] are looped, the frames leading to
+	// start_frame are played once from the closest state snapshot
+	const int start_frame = theApp.GetConfigI("replay_start_frame");
+	const int end_frame = theApp.GetConfigI("replay_end_frame");
+
+	int frame = start_frame > 0 ? file->SeekSnapshot(start_frame) : 0;
+
 	GSvsync(1);
 
 	struct Packet {uint8 type, param; uint32 size, addr; std::vector<uint8> buff;};
@@ -1131,46 +1138,89 @@ EXPORT_C GSReplay(HWND hwnd, HINSTANCE hinst, LPSTR lpszCmdLine, int nCmdShow)
 			p.buff.resize(0x2000);
 			file->Read(p.buff.data(), 0x2000);
 			break;
+		case 4:
+			file->Read(&p.size, 4);
+			p.buff.resize(p.size);
+			file->Read(p.buff.data(), p.size);
+			break;
 		}
 
 		return p;
 	};
 
 	std::list<Packet> packets;
+	std::list<Packet> prologue;
 	uint8 type;
 	while(file->Read(&type, 1))
-		packets.push_back(read_packet(type));
+	{
+		if(end_frame >= 0 && frame > end_frame)
+			break;
+
+		const bool warmup = frame < start_frame;
+
+		Packet p = read_packet(type);
+
+		if(p.type == 1)
+			frame++;
+
+		if(p.type == 4)
+		{
+			// snapshots are not needed once looping, up to start_frame they replace everything played so far
+			// (SeekSnapshot lands right on the one at start_frame when it's a multiple of the interval)
+			if(frame > start_frame)
+				continue;
+
+			prologue.clear();
+			prologue.push_back(std::move(p));
+			continue;
+		}
+
+		(warmup ? prologue : packets).push_back(std::move(p));
+	}
 
 	Sleep(100);
 
 	std::vector<uint8> buff;
-	while(IsWindowVisible(hWnd))
-	{
-		for(auto &p : packets)
+	auto play = [&](Packet& p) {
+		switch(p.type)
 		{
-			switch(p.type)
+		case 0:
+			switch(p.param)
 			{
-			case 0:
-				switch(p.param)
-				{
-				case 0: GSgifTransfer1(p.buff.data(), p.addr); break;
-				case 1: GSgifTransfer2(p.buff.data(), p.size / 16); break;
-				case 2: GSgifTransfer3(p.buff.data(), p.size / 16); break;
-				case 3: GSgifTransfer(p.buff.data(), p.size / 16); break;
-				}
-				break;
-			case 1:
-				GSvsync(p.param);
-				break;
-			case 2:
-				if(buff.size() < p.size) buff.resize(p.size);
-				GSreadFIFO2(p.buff.data(), p.size / 16);
-				break;
-			case 3:
-				memcpy(regs.data(), p.buff.data(), 0x2000);
-				break;
+			case 0: GSgifTransfer1(p.buff.data(), p.addr); break;
+			case 1: GSgifTransfer2(p.buff.data(), p.size / 16); break;
+			case 2: GSgifTransfer3(p.buff.data(), p.size / 16); break;
+			case 3: GSgifTransfer(p.buff.data(), p.size / 16); break;
 			}
+			break;
+		case 1:
+			GSvsync(p.param);
+			break;
+		case 2:
+			if(buff.size() < p.size) buff.resize(p.size);
+			GSreadFIFO2(p.buff.data(), p.size / 16);
+			break;
+		case 3:
+			memcpy(regs.data(), p.buff.data(), 0x2000);
+			break;
+		case 4:
+		{
+			GSFreezeData fd;
+			fd.size = p.size;
+			fd.data = p.buff.data();
+			GSfreeze(FREEZE_LOAD, &fd);
+			break;
+		}
 		}
+	};
+
+	for(auto &p : prologue)
+		play(p);
+
+	while(IsWindowVisible(hWnd))
+	{
+		for(auto &p : packets)
+			play(p);
 	}
 
 	Sleep(100);
@@ -1415,6 +1465,7 @@ EXPORT_C GSReplay(char* lpszCmdLine, int renderer)
 	struct Packet {uint8 type, param; uint32 size, addr; std::vector<uint8> buff;};
 
 	std::list<Packet*> packets;
+	std::list<Packet*> prologue;
 	std::vector<uint8> buff;
 	uint8 regs[0x2000];
 
@@ -1431,6 +1482,11 @@ EXPORT_C GSReplay(char* lpszCmdLine, int renderer)
 
 	long frame_number = 0;
 
+	// Only frames [start_frame, end_frame] are looped, the frames leading to
+	// start_frame are played once from the closest state snapshot
+	int start_frame = theApp.GetConfigI("replay_start_frame");
+	int end_frame = theApp.GetConfigI("replay_end_frame");
+
 	void* hWnd = NULL;
 	int err = _GSopen((void**)&hWnd, "", m_renderer);
 	if (err != 0) {
@@ -1465,9 +1521,17 @@ EXPORT_C GSReplay(char* lpszCmdLine, int renderer)
 
 		file->Read(regs, 0x2000);
 
+		if (start_frame > 0 && !repack_dump)
+			frame_number = file->SeekSnapshot(start_frame);
+
 		uint8 type;
 		while(file->Read(&type, 1))
 		{
+			if (end_frame >= 0 && frame_number > end_frame)
+				break;
+
+			bool warmup = frame_number < start_frame;
+
 			Packet* p = new Packet();
 
 			p->type = type;
@@ -1511,10 +1575,34 @@ EXPORT_C GSReplay(char* lpszCmdLine, int renderer)
 
 				file->Read(&p->buff[0], 0x2000);
 
+				break;
+
+			case 4:
+				file->Read(&p->size, 4);
+				p->buff.resize(p->size);
+				file->Read(&p->buff[0], p->size);
+
 				break;
 			}
 
-			packets.push_back(p);
+			if (type == 4)
+			{
+				// snapshots are not needed once looping, up to start_frame they replace everything played so far
+				// (SeekSnapshot lands right on the one at start_frame when it's a multiple of the interval)
+				if (frame_number > start_frame)
+				{
+					delete p;
+					continue;
+				}
+
+				for (auto i = prologue.begin(); i != prologue.end(); i++)
+					delete *i;
+				prologue.clear();
+				prologue.push_back(p);
+				continue;
+			}
+
+			(warmup ? prologue : packets).push_back(p);
 
 			if (repack_dump && frame_number > -finished)
 				break;
@@ -1525,54 +1613,70 @@ EXPORT_C GSReplay(char* lpszCmdLine, int renderer)
 
 	sleep(2);
 
-
-	frame_number = 0;
-
 	// Init vsync stuff
 	GSvsync(1);
 
-	while(finished > 0)
-	{
-		for(auto i = packets.begin(); i != packets.end(); i++)
+	auto play = [&](Packet* p) {
+		switch(p->type)
 		{
-			Packet* p = *i;
+			case 0:
 
-			switch(p->type)
-			{
-				case 0:
+				switch(p->param)
+				{
+					case 0: GSgifTransfer1(&p->buff[0], p->addr); break;
+					case 1: GSgifTransfer2(&p->buff[0], p->size / 16); break;
+					case 2: GSgifTransfer3(&p->buff[0], p->size / 16); break;
+					case 3: GSgifTransfer(&p->buff[0], p->size / 16); break;
+				}
 
-					switch(p->param)
-					{
-						case 0: GSgifTransfer1(&p->buff[0], p->addr); break;
-						case 1: GSgifTransfer2(&p->buff[0], p->size / 16); break;
-						case 2: GSgifTransfer3(&p->buff[0], p->size / 16); break;
-						case 3: GSgifTransfer(&p->buff[0], p->size / 16); break;
-					}
+				break;
 
-					break;
+			case 1:
 
-				case 1:
+				GSvsync(p->param);
+				frame_number++;
 
-					GSvsync(p->param);
-					frame_number++;
+				break;
 
-					break;
+			case 2:
 
-				case 2:
+				if(buff.size() < p->size) buff.resize(p->size);
 
-					if(buff.size() < p->size) buff.resize(p->size);
+				GSreadFIFO2(&buff[0], p->size / 16);
 
-					GSreadFIFO2(&buff[0], p->size / 16);
+				break;
 
-					break;
+			case 3:
 
-				case 3:
+				memcpy(regs, &p->buff[0], 0x2000);
 
-					memcpy(regs, &p->buff[0], 0x2000);
+				break;
 
-					break;
+			case 4:
+			{
+				GSFreezeData fd;
+				fd.size = p->size;
+				fd.data = &p->buff[0];
+				GSfreeze(FREEZE_LOAD, &fd);
+
+				break;
 			}
 		}
+	};
+
+	for(auto i = prologue.begin(); i != prologue.end(); i++)
+	{
+		play(*i);
+	}
+
+	frame_number = 0;
+
+	while(finished > 0)
+	{
+		for(auto i = packets.begin(); i != packets.end(); i++)
+		{
+			play(*i);
+		}
 
 		if (finished >= 200) {
 			; // Nop for Nvidia Profiler
@@ -1599,7 +1703,13 @@ EXPORT_C GSReplay(char* lpszCmdLine, int renderer)
 		delete *i;
 	}
 
+	for(auto i = prologue.begin(); i != prologue.end(); i++)
+	{
+		delete *i;
+	}
+
 	packets.clear();
+	prologue.clear();
 
 	sleep(2);
 
@@ -332,6 +332,47 @@ public:
 
 		// TODO: pshufb
 
+		#if _M_SSE >= 0x501
+
+		GSVector4i v4 = GSVector4i::load<alignment != 0>(&src[srcpitch * 0]);
+		GSVector4i v5 = GSVector4i::load<alignment != 0>(&src[srcpitch * 1]);
+		GSVector4i v6 = GSVector4i::load<alignment != 0>(&src[srcpitch * 2]);
+		GSVector4i v7 = GSVector4i::load<alignment != 0>(&src[srcpitch * 3]);
+
+		GSVector8i v0(v4, v5);
+		GSVector8i v1(v6, v7);
+
+		if((i & 1) == 0)
+		{
+			v1 = v1.yxwzlh();
+		}
+		else
+		{
+			v0 = v0.yxwzlh();
+		}
+
+		// rows 0/2 and 1/3 sit in the same lane, the same swaps as below run on both pairs at once
+
+		const __m256i epi32_0f0f0f0f = _mm256_set1_epi32(0x0f0f0f0f);
+
+		GSVector8i mask(epi32_0f0f0f0f);
+
+		GSVector8i e = (v1 << 4).blend(v0, mask);
+		GSVector8i f = v1.blend(v0 >> 4, mask);
+
+		v0 = e.upl8(f);
+		v1 = e.uph8(f);
+
+		GSVector8i::sw8(v0, v1);
+		GSVector8i::sw8(v0, v1);
+		GSVector8i::sw128(v0, v1);
+		GSVector8i::sw64(v0, v1);
+
+		GSVector8i::store(&((GSVector4i*)dst)[i * 4 + 0], &((GSVector4i*)dst)[i * 4 + 2], v0);
+		GSVector8i::store(&((GSVector4i*)dst)[i * 4 + 1], &((GSVector4i*)dst)[i * 4 + 3], v1);
+
+		#else
+
 		GSVector4i v0 = GSVector4i::load<alignment != 0>(&src[srcpitch * 0]);
 		GSVector4i v1 = GSVector4i::load<alignment != 0>(&src[srcpitch * 1]);
 		GSVector4i v2 = GSVector4i::load<alignment != 0>(&src[srcpitch * 2]);
@@ -357,6 +398,8 @@ public:
 		((GSVector4i*)dst)[i * 4 + 1] = v1;
 		((GSVector4i*)dst)[i * 4 + 2] = v2;
 		((GSVector4i*)dst)[i * 4 + 3] = v3;
+
+		#endif
 	}
 
 	template<int alignment, uint32 mask> static void WriteColumn32(int y, uint8* RESTRICT dst, const uint8* RESTRICT src, int srcpitch)
@@ -556,29 +599,38 @@ public:
 	{
 		//for(int j = 0; j < 64; j++) ((uint8*)src)[j] = (uint8)j;
 
-		#if 0//_M_SSE >= 0x501
+		#if _M_SSE >= 0x501
 
 		const GSVector8i* s = (const GSVector8i*)src;
-		
-		GSVector8i v0 = s[i * 2 + 0];
-		GSVector8i v1 = s[i * 2 + 1];
 
-		GSVector8i::sw8(v0, v1);
-		GSVector8i::sw16(v0, v1);
-		GSVector8i::sw8(v0, v1);
+		GSVector8i v0, v1;
+
+		if((i & 1) == 0)
+		{
+			v0 = s[i * 2 + 0];
+			v1 = s[i * 2 + 1];
+		}
+		else
+		{
+			v0 = s[i * 2 + 1];
+			v1 = s[i * 2 + 0];
+		}
+
+		GSVector8i mask = GSVector8i::broadcast128(m_r8mask);
+
+		v0 = v0.shuffle8(mask);
+		v1 = v1.shuffle8(mask);
+
 		GSVector8i::sw128(v0, v1);
 		GSVector8i::sw16(v0, v1);
 
-		v0 = v0.acbd();
-		v1 = v1.acbd();
-		v1 = v1.yxwz();
+		GSVector8i v2 = v0.ad(v1);
+		GSVector8i v3 = v0.bc(v1);
 
-		GSVector8i::storel(&dst[dstpitch * 0], v0);
-		GSVector8i::storeh(&dst[dstpitch * 1], v0);
-		GSVector8i::storel(&dst[dstpitch * 2], v1);
-		GSVector8i::storeh(&dst[dstpitch * 3], v1);
+		GSVector8i::sw32(v2, v3);
 
-		// TODO: not sure if this is worth it, not in this form, there should be a shorter path
+		GSVector8i::store(&dst[dstpitch * 0], &dst[dstpitch * 2], v2);
+		GSVector8i::store(&dst[dstpitch * 1], &dst[dstpitch * 3], v3);
 
 		#elif _M_SSE >= 0x301
 
@@ -651,7 +703,54 @@ public:
 	{
 		//printf("ReadColumn4\n");
 
-		#if _M_SSE >= 0x301
+		#if _M_SSE >= 0x501
+
+		const GSVector8i* s = (const GSVector8i*)src;
+
+		GSVector8i v0 = s[i * 2 + 0].xzyw();
+		GSVector8i v1 = s[i * 2 + 1].xzyw();
+
+		GSVector8i::sw128(v0, v1);
+		GSVector8i::sw64(v0, v1);
+
+		// the 4 bit swap pairs rows 0/2 and 1/3, which are now in the same lane
+
+		const __m256i epi32_0f0f0f0f = _mm256_set1_epi32(0x0f0f0f0f);
+
+		GSVector8i mask(epi32_0f0f0f0f);
+
+		GSVector8i e = (v1 << 4).blend(v0, mask);
+		GSVector8i f = v1.blend(v0 >> 4, mask);
+
+		v0 = e.upl8(f);
+		v1 = e.uph8(f);
+
+		GSVector8i::sw8(v0, v1);
+
+		mask = GSVector8i::broadcast128(m_r4mask);
+
+		v0 = v0.shuffle8(mask);
+		v1 = v1.shuffle8(mask);
+
+		GSVector8i::sw128(v0, v1);
+
+		GSVector8i v2, v3;
+
+		if((i & 1) == 0)
+		{
+			v2 = v0.upl16(v1);
+			v3 = v1.uph16(v0);
+		}
+		else
+		{
+			v2 = v1.upl16(v0);
+			v3 = v0.uph16(v1);
+		}
+
+		GSVector8i::store(&dst[dstpitch * 0], &dst[dstpitch * 1], v2);
+		GSVector8i::store(&dst[dstpitch * 2], &dst[dstpitch * 3], v3);
+
+		#elif _M_SSE >= 0x301
 
 		const GSVector4i* s = (const GSVector4i*)src;
 
@@ -21,10 +21,14 @@
 
 #include "stdafx.h"
 #include "GSDump.h"
+#include "GSLzma.h"
 
 GSDumpBase::GSDumpBase(const std::string& fn)
 	: m_frames(0)
 	, m_extra_frames(2)
+	, m_snapshot_interval(theApp.GetConfigI("dump_snapshot_interval"))
+	, m_fn(fn)
+	, m_length(0)
 {
 	m_gs = px_fopen(fn, "wb");
 	if (!m_gs)
@@ -33,16 +37,31 @@ GSDumpBase::GSDumpBase(const std::string& fn)
 
 GSDumpBase::~GSDumpBase()
 {
-	if(m_gs)
-		fclose(m_gs);
+	if(!m_gs)
+		return;
+
+	fclose(m_gs);
+
+	FILE* fp = px_fopen(m_fn + ".idx", "wb");
+	if (!fp) {
+		fprintf(stderr, "GSDump: Error failed to open %s.idx\n", m_fn.c_str());
+		return;
+	}
+
+	if (fwrite(m_index.data(), sizeof(m_index[0]), m_index.size(), fp) != m_index.size())
+		fprintf(stderr, "GSDump: Error failed to write frame index\n");
+
+	fclose(fp);
 }
 
 void GSDumpBase::AddHeader(uint32 crc, const GSFreezeData& fd, const GSPrivRegSet* regs)
 {
-	AppendRawData(&crc, 4);
-	AppendRawData(&fd.size, 4);
-	AppendRawData(fd.data, fd.size);
-	AppendRawData(regs, sizeof(*regs));
+	Append(&crc, 4);
+	Append(&fd.size, 4);
+	Append(fd.data, fd.size);
+	Append(regs, sizeof(*regs));
+
+	m_index.push_back(m_length);
 }
 
 void GSDumpBase::Transfer(int index, const uint8* mem, size_t size)
@@ -50,10 +69,10 @@ void GSDumpBase::Transfer(int index, const uint8* mem, size_t size)
 	if (size == 0)
 		return;
 
-	AppendRawData(0);
-	AppendRawData(static_cast<uint8>(index));
-	AppendRawData(&size, 4);
-	AppendRawData(mem, size);
+	Append(0);
+	Append(static_cast<uint8>(index));
+	Append(&size, 4);
+	Append(mem, size);
 }
 
 void GSDumpBase::ReadFIFO(uint32 size)
@@ -61,8 +80,8 @@ void GSDumpBase::ReadFIFO(uint32 size)
 	if (size == 0)
 		return;
 
-	AppendRawData(2);
-	AppendRawData(&size, 4);
+	Append(2);
+	Append(&size, 4);
 }
 
 bool GSDumpBase::VSync(int field, bool last, const GSPrivRegSet* regs)
@@ -71,11 +90,13 @@ bool GSDumpBase::VSync(int field, bool last, const GSPrivRegSet* regs)
 	if (!m_gs)
 		return true;
 
-	AppendRawData(3);
-	AppendRawData(regs, sizeof(*regs));
+	Append(3);
+	Append(regs, sizeof(*regs));
+
+	Append(1);
+	Append(static_cast<uint8>(field));
 
-	AppendRawData(1);
-	AppendRawData(static_cast<uint8>(field));
+	m_index.push_back(m_length);
 
 	if (last)
 		m_extra_frames--;
@@ -83,6 +104,23 @@ bool GSDumpBase::VSync(int field, bool last, const GSPrivRegSet* regs)
 	return (++m_frames & 1) == 0 && last && (m_extra_frames < 0);
 }
 
+bool GSDumpBase::IsSnapshotDue() const
+{
+	return m_gs && m_snapshot_interval > 0 && (m_frames % m_snapshot_interval) == 0;
+}
+
+void GSDumpBase::Snapshot(const GSFreezeData& fd)
+{
+	// Flag the frame in the index when the snapshot starts it (always the case from
+	// GSRenderer), the replayer finds it without reading through the dump then
+	if (!m_index.empty() && m_index.back() == m_length)
+		m_index.back() |= GSDumpFile::SnapshotFrame;
+
+	Append(4);
+	Append(&fd.size, 4);
+	Append(fd.data, fd.size);
+}
+
 void GSDumpBase::Write(const void *data, size_t size)
 {
 	if (!m_gs || size == 0)
@@ -121,74 +159,125 @@ GSDumpXz::GSDumpXz(const std::string& fn, uint32 crc, const GSFreezeData& fd, co
 	: GSDumpBase(fn + ".gs.xz")
 {
 	m_strm = LZMA_STREAM_INIT;
+
+#if LZMA_VERSION >= 50020002
+	// Independent blocks, the xz index allows the replayer to seek without decompressing from the start
+	lzma_mt mt = {};
+	mt.threads = std::max<uint32>(std::min<uint32>(std::thread::hardware_concurrency(), 4), 1);
+	mt.block_size = 8*1024*1024;
+	mt.preset = 6;
+	mt.check = LZMA_CHECK_CRC64;
+
+	// The encoder state lives next to GS memory and textures, which is tight in a 32-bit
+	// process (about 100MB per thread at preset 6). Drop threads, then shrink the blocks,
+	// to fit the budget, and fall back to the single threaded encoder if it still doesn't.
+	const uint64 budget = (sizeof(void*) == 4 ? 128ull : 512ull) * 1024 * 1024;
+
+	while (mt.threads > 1 && lzma_stream_encoder_mt_memusage(&mt) > budget)
+		mt.threads--;
+	while (mt.block_size > 1024*1024 && lzma_stream_encoder_mt_memusage(&mt) > budget)
+		mt.block_size /= 2;
+
+	lzma_ret ret = LZMA_MEMLIMIT_ERROR;
+	if (lzma_stream_encoder_mt_memusage(&mt) <= budget)
+		ret = lzma_stream_encoder_mt(&m_strm, &mt);
+	if (ret != LZMA_OK) {
+		fprintf(stderr, "GSDumpXz: multi-threaded encoder unavailable (error code %u), seeking in the dump will be slow\n", ret);
+		ret = lzma_easy_encoder(&m_strm, 6 /*level*/, LZMA_CHECK_CRC64);
+	}
+#else
 	lzma_ret ret = lzma_easy_encoder(&m_strm, 6 /*level*/, LZMA_CHECK_CRC64);
+#endif
 	if (ret != LZMA_OK) {
 		fprintf(stderr, "GSDumpXz: Error initializing LZMA encoder ! (error code %u)\n", ret);
 		return;
 	}
 
+	m_in_buff = std::make_shared<std::vector<uint8>>();
+	m_out_buff.resize(1024*1024);
+
+	m_compressor = std::unique_ptr<GSJobQueue<std::shared_ptr<std::vector<uint8>>, 8>>(
+		new GSJobQueue<std::shared_ptr<std::vector<uint8>>, 8>([this](std::shared_ptr<std::vector<uint8>>& buff) {
+			m_strm.next_in = buff->data();
+			m_strm.avail_in = buff->size();
+
+			Compress(LZMA_RUN);
+
+			buff.reset();
+		}));
+
 	AddHeader(crc, fd, regs);
 }
 
 GSDumpXz::~GSDumpXz()
 {
-	Flush();
+	if (m_compressor) {
+		Flush();
+
+		m_compressor->Wait();
+		m_compressor.reset();
 
-	// Finish the stream
-	m_strm.avail_in = 0;
-	Compress(LZMA_FINISH, LZMA_STREAM_END);
+		// Finish the stream
+		m_strm.avail_in = 0;
+		Compress(LZMA_FINISH);
+	}
 
 	lzma_end(&m_strm);
 }
 
 void GSDumpXz::AppendRawData(const void *data, size_t size)
 {
-	size_t old_size = m_in_buff.size();
-	m_in_buff.resize(old_size + size);
-	memcpy(&m_in_buff[old_size], data, size);
+	if (!m_compressor)
+		return;
 
-	// Enough data was accumulated, time to write/compress it.  If compression
-	// is enabled, it will freeze PCSX2. 1GB should be enough for long dump.
-	//
-	// Note: long dumps are currently not supported so this path won't be executed
-	if (m_in_buff.size() > 1024*1024*1024)
+	size_t old_size = m_in_buff->size();
+	m_in_buff->resize(old_size + size);
+	memcpy(&(*m_in_buff)[old_size], data, size);
+
+	// Enough data was accumulated, hand it over to the compression thread. The GS
+	// thread only waits when the compressor is more than a few buffers behind.
+	if (m_in_buff->size() >= 8*1024*1024)
 		Flush();
 }
 
 void GSDumpXz::AppendRawData(uint8 c)
 {
-	m_in_buff.push_back(c);
+	if (!m_compressor)
+		return;
+
+	m_in_buff->push_back(c);
 }
 
 void GSDumpXz::Flush()
 {
-	if (m_in_buff.empty())
+	if (m_in_buff->empty())
 		return;
 
-	m_strm.next_in = m_in_buff.data();
-	m_strm.avail_in = m_in_buff.size();
-
-	Compress(LZMA_RUN, LZMA_OK);
+	m_compressor->Push(m_in_buff);
 
-	m_in_buff.clear();
+	m_in_buff = std::make_shared<std::vector<uint8>>();
 }
 
-void GSDumpXz::Compress(lzma_action action, lzma_ret expected_status)
+void GSDumpXz::Compress(lzma_action action)
 {
-	std::vector<uint8> out_buff(1024*1024);
-	do {
-		m_strm.next_out = out_buff.data();
-		m_strm.avail_out = out_buff.size();
+	while (true) {
+		m_strm.next_out = m_out_buff.data();
+		m_strm.avail_out = m_out_buff.size();
 
 		lzma_ret ret = lzma_code(&m_strm, action);
 
-		if (ret != expected_status) {
+		if (ret != LZMA_OK && ret != LZMA_STREAM_END) {
 			fprintf (stderr, "GSDumpXz: Error %d\n", (int) ret);
 			return;
 		}
 
-		size_t write_size = out_buff.size() - m_strm.avail_out;
-		Write(out_buff.data(), write_size);
+		size_t write_size = m_out_buff.size() - m_strm.avail_out;
+		Write(m_out_buff.data(), write_size);
 
-	} while (m_strm.avail_out == 0);
+		if (ret == LZMA_STREAM_END)
+			return;
+
+		if (action == LZMA_RUN && m_strm.avail_in == 0 && m_strm.avail_out != 0)
+			return;
+	}
 }
@@ -23,6 +23,7 @@
 
 #include "GS.h"
 #include "Renderers/SW/GSVertexSW.h"
+#include "GSThread_CXX11.h"
 #include <lzma.h>
 
 /*
@@ -42,14 +43,31 @@ ReadFIFO2 data (id == 2)
 Regs data (id == 3)
 - [PMODE/0x2000]
 
+State snapshot (id == 4), written at the start of a frame every dump_snapshot_interval vsyncs
+- [4/1] [size/4] [data/size]
+
+Frame index (written next to the dump as <dump>.idx)
+- [offset/8] .. [offset/8]
+
+Uncompressed offset of the first packet of each frame, the first entry points
+right after the header. The top bit is set when the frame starts with a state snapshot.
+
 */
 
 class GSDumpBase
 {
 	int m_frames;
 	int m_extra_frames;
+	int m_snapshot_interval;
 	FILE* m_gs;
 
+	std::string m_fn;
+	uint64 m_length;
+	std::vector<uint64> m_index;
+
+	void Append(const void *data, size_t size) {m_length += size; AppendRawData(data, size);}
+	void Append(uint8 c) {m_length++; AppendRawData(c);}
+
 protected:
 	void AddHeader(uint32 crc, const GSFreezeData& fd, const GSPrivRegSet* regs);
 	void Write(const void *data, size_t size);
@@ -64,6 +82,8 @@ public:
 	void ReadFIFO(uint32 size);
 	void Transfer(int index, const uint8* mem, size_t size);
 	bool VSync(int field, bool last, const GSPrivRegSet* regs);
+	bool IsSnapshotDue() const;
+	void Snapshot(const GSFreezeData& fd);
 };
 
 class GSDump final : public GSDumpBase
@@ -80,10 +100,16 @@ class GSDumpXz final : public GSDumpBase
 {
 	lzma_stream m_strm;
 
-	std::vector<uint8> m_in_buff;
+	std::shared_ptr<std::vector<uint8>> m_in_buff;
+	std::vector<uint8> m_out_buff;
+
+	// compression and file writes run on this thread, lzma splits the work further
+	// between its own threads when built with multi-threaded encoder support
+
+	std::unique_ptr<GSJobQueue<std::shared_ptr<std::vector<uint8>>, 8>> m_compressor;
 
 	void Flush();
-	void Compress(lzma_action action, lzma_ret expected_status);
+	void Compress(lzma_action action);
 	void AppendRawData(const void *data, size_t size);
 	void AppendRawData(uint8 c);
 
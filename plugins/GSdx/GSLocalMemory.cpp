@@ -365,6 +365,11 @@ GSLocalMemory::GSLocalMemory()
 	m_psm[PSM_PSMZ16].wi = &GSLocalMemory::WriteImage<PSM_PSMZ16, 16, 8, 16>;
 	m_psm[PSM_PSMZ16S].wi = &GSLocalMemory::WriteImage<PSM_PSMZ16S, 16, 8, 16>;
 
+	m_psm[PSM_PSMCT32].ri = &GSLocalMemory::ReadImage<PSM_PSMCT32, 8, 8, 32>;
+	m_psm[PSM_PSMCT24].ri = &GSLocalMemory::ReadImage<PSM_PSMCT24, 8, 8, 24>;
+	m_psm[PSM_PSMZ32].ri = &GSLocalMemory::ReadImage<PSM_PSMZ32, 8, 8, 32>;
+	m_psm[PSM_PSMZ24].ri = &GSLocalMemory::ReadImage<PSM_PSMZ24, 8, 8, 24>;
+
 	m_psm[PSM_PSMCT24].rtx = &GSLocalMemory::ReadTexture24;
 	m_psm[PSM_PSGPU24].rtx = &GSLocalMemory::ReadTextureGPU24;
 	m_psm[PSM_PSMCT16].rtx = &GSLocalMemory::ReadTexture16;
@@ -1420,6 +1425,140 @@ void GSLocalMemory::WriteImageX(int& tx, int& ty, const uint8* src, int len, GIF
 
 //
 
+template<int psm, int bsx, int bsy, int trbpp>
+void GSLocalMemory::ReadImageBlock(int l, int r, int la, int ra, int y, int h, uint8* dst, int dstpitch, const GIFRegBITBLTBUF& BITBLTBUF) const
+{
+	alignas(32) uint8 buff[bsx * bsy * 4];
+
+	uint32 bp = BITBLTBUF.SBP;
+	uint32 bw = BITBLTBUF.SBW;
+
+	for(; h >= bsy; h -= bsy, y += bsy, dst += dstpitch * bsy)
+	{
+		// left and right parts
+
+		for(int i = 0; i < bsy; i++)
+		{
+			uint8* RESTRICT d = &dst[dstpitch * i];
+
+			for(int x = l; x < r; x++)
+			{
+				if(x == la) x = ra;
+				if(x >= r) break;
+
+				uint8* RESTRICT p = &d[(x - l) * trbpp >> 3];
+
+				switch(psm)
+				{
+				case PSM_PSMCT32: *(uint32*)p = ReadPixel32(x, y + i, bp, bw); break;
+				case PSM_PSMZ32: *(uint32*)p = ReadPixel32Z(x, y + i, bp, bw); break;
+				case PSM_PSMCT24: {uint32 c = ReadPixel24(x, y + i, bp, bw); memcpy(p, &c, 3);} break;
+				case PSM_PSMZ24: {uint32 c = ReadPixel24Z(x, y + i, bp, bw); memcpy(p, &c, 3);} break;
+				default: __assume(0);
+				}
+			}
+		}
+
+		// horizontally aligned part
+
+		for(int x = la; x < ra; x += bsx)
+		{
+			const uint8* RESTRICT src = NULL;
+
+			switch(psm)
+			{
+			case PSM_PSMCT32: case PSM_PSMCT24: src = BlockPtr32(x, y, bp, bw); break;
+			case PSM_PSMZ32: case PSM_PSMZ24: src = BlockPtr32Z(x, y, bp, bw); break;
+			default: __assume(0);
+			}
+
+			uint8* RESTRICT d = &dst[(x - l) * trbpp >> 3];
+
+			if(trbpp == 32)
+			{
+				GSBlock::ReadBlock32(src, d, dstpitch);
+
+				continue;
+			}
+
+			GSBlock::ReadBlock32(src, buff, bsx * 4);
+
+			for(int i = 0; i < bsy; i++, d += dstpitch)
+			{
+				const uint8* RESTRICT s = &buff[i * bsx * 4];
+
+				for(int j = 0; j < bsx; j++)
+				{
+					d[j * 3 + 0] = s[j * 4 + 0];
+					d[j * 3 + 1] = s[j * 4 + 1];
+					d[j * 3 + 2] = s[j * 4 + 2];
+				}
+			}
+		}
+	}
+}
+
+template<int psm, int bsx, int bsy, int trbpp>
+void GSLocalMemory::ReadImage(int& tx, int& ty, uint8* dst, int len, GIFRegBITBLTBUF& BITBLTBUF, GIFRegTRXPOS& TRXPOS, GIFRegTRXREG& TRXREG) const
+{
+	if(TRXREG.RRW == 0) return;
+
+	int l = (int)TRXPOS.SSAX;
+	int r = l + (int)TRXREG.RRW;
+
+	// finish the incomplete row first
+
+	if(tx != l)
+	{
+		int n = std::min(len, (r - tx) * trbpp >> 3);
+		ReadImageX(tx, ty, dst, n, BITBLTBUF, TRXPOS, TRXREG);
+		dst += n;
+		len -= n;
+	}
+
+	int la = (l + (bsx - 1)) & ~(bsx - 1);
+	int ra = r & ~(bsx - 1);
+	int dstpitch = (r - l) * trbpp >> 3;
+	int h = len / dstpitch;
+
+	// 32 bit blocks are stored straight into dst, the unaligned case is left to ReadImageX, its column loop beats a bounce buffer
+
+	bool aligned = trbpp != 32 || (((size_t)&dst[(la - l) * 4] & 31) == 0 && (dstpitch & 31) == 0);
+
+	if(ra - la >= bsx && h > 0 && aligned) // "transfer width" >= "block width" && there is at least one full row
+	{
+		// top part, up to the first block boundary
+
+		int h2 = std::min(h, (bsy - (ty & (bsy - 1))) & (bsy - 1));
+
+		if(h2 > 0)
+		{
+			int n = dstpitch * h2;
+			ReadImageX(tx, ty, dst, n, BITBLTBUF, TRXPOS, TRXREG);
+			dst += n;
+			len -= n;
+			h -= h2;
+		}
+
+		// vertically aligned part
+
+		h2 = h & ~(bsy - 1);
+
+		if(h2 > 0)
+		{
+			ReadImageBlock<psm, bsx, bsy, trbpp>(l, r, la, ra, ty, h2, dst, dstpitch, BITBLTBUF);
+
+			dst += dstpitch * h2;
+			len -= dstpitch * h2;
+			ty += h2;
+		}
+	}
+
+	// bottom part and incomplete last row
+
+	ReadImageX(tx, ty, dst, len, BITBLTBUF, TRXPOS, TRXREG);
+}
+
 void GSLocalMemory::ReadImageX(int& tx, int& ty, uint8* dst, int len, GIFRegBITBLTBUF& BITBLTBUF, GIFRegTRXPOS& TRXPOS, GIFRegTRXREG& TRXREG) const
 {
 	if(len <= 0) return;
@@ -870,7 +870,13 @@ public:
 	void WriteImage24Z(int& tx, int& ty, const uint8* src, int len, GIFRegBITBLTBUF& BITBLTBUF, GIFRegTRXPOS& TRXPOS, GIFRegTRXREG& TRXREG);
 	void WriteImageX(int& tx, int& ty, const uint8* src, int len, GIFRegBITBLTBUF& BITBLTBUF, GIFRegTRXPOS& TRXPOS, GIFRegTRXREG& TRXREG);
 
-	// TODO: ReadImage32/24/...
+	template<int psm, int bsx, int bsy, int trbpp>
+	void ReadImageBlock(int l, int r, int la, int ra, int y, int h, uint8* dst, int dstpitch, const GIFRegBITBLTBUF& BITBLTBUF) const;
+
+	template<int psm, int bsx, int bsy, int trbpp>
+	void ReadImage(int& tx, int& ty, uint8* dst, int len, GIFRegBITBLTBUF& BITBLTBUF, GIFRegTRXPOS& TRXPOS, GIFRegTRXREG& TRXREG) const;
+
+	// TODO: ReadImage16/8/...
 
 	void ReadImageX(int& tx, int& ty, uint8* dst, int len, GIFRegBITBLTBUF& BITBLTBUF, GIFRegTRXPOS& TRXPOS, GIFRegTRXREG& TRXREG) const;
 
@@ -21,7 +21,25 @@
 #include "stdafx.h"
 #include "GSLzma.h"
 
-GSDumpFile::GSDumpFile(char* filename, const char* repack_filename) {
+static int dump_fseek(FILE* fp, int64 offset, int origin) {
+#ifdef _WIN32
+	return _fseeki64(fp, offset, origin);
+#else
+	return fseeko(fp, offset, origin);
+#endif
+}
+
+static int64 dump_ftell(FILE* fp) {
+#ifdef _WIN32
+	return _ftelli64(fp);
+#else
+	return ftello(fp);
+#endif
+}
+
+GSDumpFile::GSDumpFile(char* filename, const char* repack_filename)
+	: m_filename(filename)
+	, m_frame_index_loaded(false) {
 	m_fp = fopen(filename, "rb");
 	if (m_fp == nullptr) {
 		fprintf(stderr, "failed to open %s\n", filename);
@@ -46,6 +64,44 @@ void GSDumpFile::Repack(void* ptr, size_t size) {
 
 }
 
+bool GSDumpFile::SeekFrame(int frame) {
+	if (!m_frame_index_loaded) {
+		m_frame_index_loaded = true;
+
+		FILE* fp = fopen((m_filename + ".idx").c_str(), "rb");
+		if (fp == nullptr) {
+			fprintf(stderr, "No frame index for %s\n", m_filename.c_str());
+			return false;
+		}
+
+		uint64 offset;
+		while (fread(&offset, sizeof(offset), 1, fp) == 1)
+			m_frame_offset.push_back(offset);
+
+		fclose(fp);
+	}
+
+	if (frame < 0 || frame >= (int)m_frame_offset.size())
+		return false;
+
+	return Seek(m_frame_offset[frame] & ~SnapshotFrame);
+}
+
+int GSDumpFile::SeekSnapshot(int frame) {
+	if (!SeekFrame(0))
+		return 0;
+
+	// The writer flags the frames that start with a snapshot in the index
+	for (int f = std::min(frame, (int)m_frame_offset.size() - 1); f > 0; f--) {
+		if ((m_frame_offset[f] & SnapshotFrame) && SeekFrame(f))
+			return f;
+	}
+
+	SeekFrame(0);
+
+	return 0;
+}
+
 GSDumpFile::~GSDumpFile() {
 	if (m_fp)
 		fclose(m_fp);
@@ -76,6 +132,10 @@ GSDumpLzma::GSDumpLzma(char* filename, const char* repack_filename) : GSDumpFile
 
 	m_strm.avail_out = m_buff_size;
 	m_strm.next_out  = m_area;
+
+	m_index      = nullptr;
+	m_block_mode = false;
+	m_block_eof  = false;
 }
 
 void GSDumpLzma::Decompress() {
@@ -98,7 +158,12 @@ void GSDumpLzma::Decompress() {
 	lzma_ret ret = lzma_code(&m_strm, action);
 
 	if (ret != LZMA_OK) {
-		if (ret == LZMA_STREAM_END)
+		if (ret == LZMA_STREAM_END && m_block_mode) {
+			// Continue with the next block, or stop before the xz index
+			if (lzma_index_iter_next(&m_iter, LZMA_INDEX_ITER_BLOCK) || !StartBlock())
+				m_block_eof = true;
+		}
+		else if (ret == LZMA_STREAM_END)
 			fprintf(stderr, "LZMA decoder finished without error\n\n");
 		else {
 			fprintf(stderr, "Decoder error: (error code %u)\n", ret);
@@ -111,6 +176,9 @@ void GSDumpLzma::Decompress() {
 }
 
 bool GSDumpLzma::IsEof() {
+	if (m_block_mode)
+		return m_block_eof && m_avail == 0;
+
 	return feof(m_fp) && m_avail == 0 && m_strm.avail_in == 0;
 }
 
@@ -139,9 +207,113 @@ bool GSDumpLzma::Read(void* ptr, size_t size) {
 	return false;
 }
 
+bool GSDumpLzma::LoadIndex() {
+	lzma_stream_flags flags;
+	uint8_t footer[LZMA_STREAM_HEADER_SIZE];
+
+	if (dump_fseek(m_fp, -LZMA_STREAM_HEADER_SIZE, SEEK_END) != 0
+		|| fread(footer, 1, sizeof(footer), m_fp) != sizeof(footer)
+		|| lzma_stream_footer_decode(&flags, footer) != LZMA_OK)
+		return false;
+
+	int64 file_size = dump_fseek(m_fp, 0, SEEK_END) == 0 ? dump_ftell(m_fp) : -1;
+
+	std::vector<uint8_t> buff((size_t)flags.backward_size);
+	if (dump_fseek(m_fp, -(int64)(LZMA_STREAM_HEADER_SIZE + flags.backward_size), SEEK_END) != 0
+		|| fread(buff.data(), 1, buff.size(), m_fp) != buff.size())
+		return false;
+
+	uint64_t memlimit = UINT64_MAX;
+	size_t pos = 0;
+	if (lzma_index_buffer_decode(&m_index, &memlimit, nullptr, buff.data(), &pos, buff.size()) != LZMA_OK)
+		return false;
+
+	// Only a single stream without padding is supported (what GSDumpXz writes)
+	if (lzma_index_stream_flags(m_index, &flags) != LZMA_OK || (int64)lzma_index_file_size(m_index) != file_size) {
+		lzma_index_end(m_index, nullptr);
+		m_index = nullptr;
+		return false;
+	}
+
+	return true;
+}
+
+bool GSDumpLzma::StartBlock() {
+	uint8_t header[LZMA_BLOCK_HEADER_SIZE_MAX];
+	lzma_filter filters[LZMA_FILTERS_MAX + 1];
+
+	lzma_block block = {};
+	block.version = 0;
+	block.check   = m_iter.stream.flags->check;
+	block.filters = filters;
+
+	if (dump_fseek(m_fp, m_iter.block.compressed_file_offset, SEEK_SET) != 0
+		|| fread(header, 1, 1, m_fp) != 1)
+		return false;
+
+	block.header_size = lzma_block_header_size_decode(header[0]);
+
+	if (fread(header + 1, 1, block.header_size - 1, m_fp) != block.header_size - 1
+		|| lzma_block_header_decode(&block, nullptr, header) != LZMA_OK)
+		return false;
+
+	lzma_ret ret = lzma_block_compressed_size(&block, m_iter.block.unpadded_size);
+	if (ret == LZMA_OK)
+		ret = lzma_block_decoder(&m_strm, &block);
+
+	for (int i = 0; filters[i].id != LZMA_VLI_UNKNOWN; i++)
+		free(filters[i].options);
+
+	m_strm.avail_in = 0;
+	m_strm.next_in  = m_inbuf;
+
+	return ret == LZMA_OK;
+}
+
+bool GSDumpLzma::Seek(uint64 offset) {
+	if (m_index == nullptr) {
+		int64 pos = dump_ftell(m_fp);
+		bool loaded = LoadIndex();
+		dump_fseek(m_fp, pos, SEEK_SET);
+
+		if (!loaded) {
+			fprintf(stderr, "Failed to read the xz index, the dump can't be seeked\n");
+			return false;
+		}
+	}
+
+	lzma_index_iter_init(&m_iter, m_index);
+
+	if (lzma_index_iter_locate(&m_iter, offset) || !StartBlock()) {
+		fprintf(stderr, "Failed to seek to offset %llu\n", (unsigned long long)offset);
+		return false;
+	}
+
+	m_block_mode = true;
+	m_block_eof  = false;
+	m_avail      = 0;
+	m_start      = 0;
+
+	// Skip the beginning of the block
+	for (uint64 skip = offset - m_iter.block.uncompressed_file_offset; skip > 0 && !IsEof(); ) {
+		if (m_avail == 0)
+			Decompress();
+
+		size_t l = (size_t)std::min<uint64>(skip, m_avail);
+		m_avail -= l;
+		m_start += l;
+		skip    -= l;
+	}
+
+	return !IsEof();
+}
+
 GSDumpLzma::~GSDumpLzma() {
 	lzma_end(&m_strm);
 
+	if (m_index)
+		lzma_index_end(m_index, nullptr);
+
 	if (m_inbuf)
 		_aligned_free(m_inbuf);
 	if (m_area)
@@ -162,6 +334,10 @@ bool GSDumpRaw::IsEof() {
 	return !!feof(m_fp);
 }
 
+bool GSDumpRaw::Seek(uint64 offset) {
+	return dump_fseek(m_fp, offset, SEEK_SET) == 0;
+}
+
 bool GSDumpRaw::Read(void* ptr, size_t size) {
 	size_t ret = fread(ptr, 1, size, m_fp);
 	if (ret != size && ferror(m_fp)) {
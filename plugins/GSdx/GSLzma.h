@@ -23,14 +23,29 @@
 class GSDumpFile {
 	FILE*		m_repack_fp;
 
+	std::string	m_filename;
+	std::vector<uint64> m_frame_offset;
+	bool		m_frame_index_loaded;
+
 	protected:
 	FILE*		m_fp;
 
 	void Repack(void* ptr, size_t size);
 
 	public:
+	// Set on the frame index entries of the frames that start with a state snapshot
+	static const uint64 SnapshotFrame = 1ULL << 63;
+
 	virtual bool IsEof() = 0;
 	virtual bool Read(void* ptr, size_t size) = 0;
+	virtual bool Seek(uint64 offset) = 0;
+
+	// Uses the frame index written next to the dump, frame 0 starts right after the header
+	bool SeekFrame(int frame);
+
+	// Moves to the closest state snapshot at or before frame and returns its frame,
+	// returns 0 when there is none (positioned on frame 0 if the dump has an index)
+	int SeekSnapshot(int frame);
 
 	GSDumpFile(char* filename, const char* repack_filename);
 	virtual ~GSDumpFile();
@@ -47,7 +62,15 @@ class GSDumpLzma : public GSDumpFile {
 	size_t		m_avail;
 	size_t		m_start;
 
+	// After a seek the blocks are decoded one by one, following the xz index
+	lzma_index*	m_index;
+	lzma_index_iter	m_iter;
+	bool		m_block_mode;
+	bool		m_block_eof;
+
 	void Decompress();
+	bool LoadIndex();
+	bool StartBlock();
 
 	public:
 
@@ -56,6 +79,7 @@ class GSDumpLzma : public GSDumpFile {
 
 	bool IsEof() final;
 	bool Read(void* ptr, size_t size) final;
+	bool Seek(uint64 offset) final;
 };
 
 class GSDumpRaw : public GSDumpFile {
@@ -74,4 +98,5 @@ class GSDumpRaw : public GSDumpFile {
 
 	bool IsEof() final;
 	bool Read(void* ptr, size_t size) final;
+	bool Seek(uint64 offset) final;
 };
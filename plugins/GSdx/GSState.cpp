@@ -1649,7 +1649,11 @@ void GSState::FlushPrim()
 
 		if(GSLocalMemory::m_psm[m_context->FRAME.PSM].fmt < 3 && GSLocalMemory::m_psm[m_context->ZBUF.PSM].fmt < 3)
 		{
-			m_vt.Update(m_vertex.buff, m_index.buff, m_vertex.tail, m_index.tail, GSUtil::GetPrimClass(PRIM->PRIM));
+			{
+				GSPerfMonAutoTimer pmat(&m_perfmon, GSPerfMon::Prepass);
+
+				m_vt.Update(m_vertex.buff, m_index.buff, m_vertex.tail, m_index.tail, GSUtil::GetPrimClass(PRIM->PRIM));
+			}
 
 			m_context->SaveReg();
 
@@ -1844,7 +1848,7 @@ void GSState::Read(uint8* mem, int len)
 		}
 	}
 
-	m_mem.ReadImageX(m_tr.x, m_tr.y, mem, len, m_env.BITBLTBUF, m_env.TRXPOS, m_env.TRXREG);
+	(m_mem.*GSLocalMemory::m_psm[m_env.BITBLTBUF.SPSM].ri)(m_tr.x, m_tr.y, mem, len, m_env.BITBLTBUF, m_env.TRXPOS, m_env.TRXREG);
 
 	if(s_dump && s_save && s_n >= s_saven) {
 		std::string s = m_dump_root + format("%05d_read_%05x_%d_%d_%d_%d_%d_%d.bmp",
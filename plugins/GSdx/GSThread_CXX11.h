@@ -113,3 +113,55 @@ public:
 		m_func(item);
 	}
 };
+
+// Splits [0, count) into one range per worker plus one for the calling thread,
+// and returns once every range has been processed.
+class GSWorkerPool final
+{
+	struct Job
+	{
+		const std::function<void(int, int)>* func;
+		int begin, end;
+	};
+
+	using GSWorker = GSJobQueue<Job, 16>;
+
+	std::vector<std::unique_ptr<GSWorker>> m_workers;
+
+public:
+	GSWorkerPool(int threads)
+	{
+		for(int i = 0; i < threads; i++)
+		{
+			m_workers.push_back(std::unique_ptr<GSWorker>(new GSWorker(
+				[](Job& job) { (*job.func)(job.begin, job.end); })));
+		}
+	}
+
+	int GetThreads() const
+	{
+		return (int)m_workers.size();
+	}
+
+	// range boundaries are multiples of align, ranges smaller than min_size are merged
+	void Run(int count, int align, int min_size, const std::function<void(int, int)>& func)
+	{
+		int parts = std::min<int>(GetThreads() + 1, std::max<int>(count / std::max<int>(min_size, 1), 1));
+		int step = ((count + parts - 1) / parts + align - 1) / align * align;
+
+		int begin = 0;
+		size_t pushed = 0;
+
+		for(; pushed < m_workers.size() && begin + step < count; pushed++, begin += step)
+		{
+			m_workers[pushed]->Push({&func, begin, begin + step});
+		}
+
+		func(begin, count);
+
+		for(size_t i = 0; i < pushed; i++)
+		{
+			m_workers[i]->Wait();
+		}
+	}
+};
@@ -256,4 +256,17 @@ public:
 
 		return ret;
 	}
+
+	void Precompile(KEY key)
+	{
+		GetDefaultFunction(key);
+	}
+
+	void GetKeys(std::vector<KEY>& keys) const
+	{
+		for(const auto& i : m_cgmap)
+		{
+			keys.push_back(i.first);
+		}
+	}
 };
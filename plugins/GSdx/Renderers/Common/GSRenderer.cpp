@@ -385,7 +385,7 @@ void GSRenderer::VSync(int field)
 					sum += m_perfmon.CPU(GSPerfMon::WorkerDraw0 + i);
 				}
 
-				s += format(" | %d%% CPU", sum);
+				s += format(" | %d%% CPU | %d%% prepass", sum, m_perfmon.CPU(GSPerfMon::Prepass));
 			}
 		}
 		else
@@ -469,7 +469,21 @@ void GSRenderer::VSync(int field)
 	else if(m_dump)
 	{
 		if(m_dump->VSync(field, !m_control_key, m_regs))
+		{
 			m_dump.reset();
+		}
+		else if(m_dump->IsSnapshotDue())
+		{
+			// lets the replayer start close to any frame
+			GSFreezeData fd = {0, nullptr};
+			Freeze(&fd, true);
+			fd.data = new uint8[fd.size];
+			Freeze(&fd, false);
+
+			m_dump->Snapshot(fd);
+
+			delete [] fd.data;
+		}
 	}
 
 	// capture
@@ -32,7 +32,7 @@ void GSVertexTrace::InitVectors()
 }
 
 GSVertexTrace::GSVertexTrace(const GSState* state)
-	: m_accurate_stq(false), m_state(state), m_primclass(GS_INVALID_CLASS)
+	: m_accurate_stq(false), m_state(state), m_pool(NULL), m_primclass(GS_INVALID_CLASS)
 {
 	m_force_filter = static_cast<BiFiltering>(theApp.GetConfigI("filter"));
 	memset(&m_alpha, 0, sizeof(m_alpha));
@@ -155,10 +155,8 @@ void GSVertexTrace::Update(const void* vertex, const uint32* index, int v_count,
 }
 
 template<GS_PRIM_CLASS primclass, uint32 iip, uint32 tme, uint32 fst, uint32 color, uint32 accurate_stq>
-void GSVertexTrace::FindMinMax(const void* vertex, const uint32* index, int count)
+void GSVertexTrace::FindMinMaxRange(MinMax& RESTRICT mm, const GSVertex* RESTRICT v, const uint32* RESTRICT index, int begin, int end)
 {
-	const GSDrawingContext* context = m_state->m_context;
-
 	int n = 1;
 
 	switch(primclass)
@@ -175,26 +173,24 @@ void GSVertexTrace::FindMinMax(const void* vertex, const uint32* index, int coun
 		break;
 	}
 
-	GSVector4 tmin = s_minmax.xxxx();
-	GSVector4 tmax = s_minmax.yyyy();
-	GSVector4i cmin = GSVector4i::xffffffff();
-	GSVector4i cmax = GSVector4i::zero();
+	GSVector4 tmin = mm.tmin;
+	GSVector4 tmax = mm.tmax;
+	GSVector4i cmin = mm.cmin;
+	GSVector4i cmax = mm.cmax;
 
 	#if _M_SSE >= 0x401
 
-	GSVector4i pmin = GSVector4i::xffffffff();
-	GSVector4i pmax = GSVector4i::zero();
+	GSVector4i pmin = mm.pmin;
+	GSVector4i pmax = mm.pmax;
 
 	#else
 
-	GSVector4 pmin = s_minmax.xxxx();
-	GSVector4 pmax = s_minmax.yyyy();
-	
-	#endif
+	GSVector4 pmin = mm.pmin;
+	GSVector4 pmax = mm.pmax;
 
-	const GSVertex* RESTRICT v = (GSVertex*)vertex;
+	#endif
 
-	for(int i = 0; i < count; i += n)
+	for(int i = begin; i < end; i += n)
 	{
 		if(primclass == GS_POINT_CLASS)
 		{
@@ -516,6 +512,98 @@ void GSVertexTrace::FindMinMax(const void* vertex, const uint32* index, int coun
 		}
 	}
 
+	mm.tmin = tmin;
+	mm.tmax = tmax;
+	mm.cmin = cmin;
+	mm.cmax = cmax;
+	mm.pmin = pmin;
+	mm.pmax = pmax;
+}
+
+template<GS_PRIM_CLASS primclass, uint32 iip, uint32 tme, uint32 fst, uint32 color, uint32 accurate_stq>
+void GSVertexTrace::FindMinMax(const void* vertex, const uint32* index, int count)
+{
+	const GSDrawingContext* context = m_state->m_context;
+
+	const int n = primclass == GS_POINT_CLASS ? 1 : primclass == GS_TRIANGLE_CLASS ? 3 : 2;
+
+	MinMax mm;
+
+	mm.tmin = s_minmax.xxxx();
+	mm.tmax = s_minmax.yyyy();
+	mm.cmin = GSVector4i::xffffffff();
+	mm.cmax = GSVector4i::zero();
+
+	#if _M_SSE >= 0x401
+
+	mm.pmin = GSVector4i::xffffffff();
+	mm.pmax = GSVector4i::zero();
+
+	#else
+
+	mm.pmin = s_minmax.xxxx();
+	mm.pmax = s_minmax.yyyy();
+
+	#endif
+
+	const GSVertex* RESTRICT v = (GSVertex*)vertex;
+
+	if(m_pool != NULL && count >= PARALLEL_MIN_INDICES * 2)
+	{
+		// min/max are order independent, each range is traced separately and merged
+
+		const MinMax init = mm;
+
+		std::mutex lock;
+
+		m_pool->Run(count, n, PARALLEL_MIN_INDICES, [&](int begin, int end)
+		{
+			MinMax part = init;
+
+			FindMinMaxRange<primclass, iip, tme, fst, color, accurate_stq>(part, v, index, begin, end);
+
+			std::lock_guard<std::mutex> l(lock);
+
+			mm.tmin = mm.tmin.min(part.tmin);
+			mm.tmax = mm.tmax.max(part.tmax);
+			mm.cmin = mm.cmin.min_u8(part.cmin);
+			mm.cmax = mm.cmax.max_u8(part.cmax);
+
+			#if _M_SSE >= 0x401
+
+			mm.pmin = mm.pmin.min_u32(part.pmin);
+			mm.pmax = mm.pmax.max_u32(part.pmax);
+
+			#else
+
+			mm.pmin = mm.pmin.min(part.pmin);
+			mm.pmax = mm.pmax.max(part.pmax);
+
+			#endif
+		});
+	}
+	else
+	{
+		FindMinMaxRange<primclass, iip, tme, fst, color, accurate_stq>(mm, v, index, 0, count);
+	}
+
+	GSVector4 tmin = mm.tmin;
+	GSVector4 tmax = mm.tmax;
+	GSVector4i cmin = mm.cmin;
+	GSVector4i cmax = mm.cmax;
+
+	#if _M_SSE >= 0x401
+
+	GSVector4i pmin = mm.pmin;
+	GSVector4i pmax = mm.pmax;
+
+	#else
+
+	GSVector4 pmin = mm.pmin;
+	GSVector4 pmax = mm.pmax;
+
+	#endif
+
 	// FIXME/WARNING. A division by 2 is done on the depth. I suspect to avoid
 	// negative value. However it means that we lost the lsb bit. m_eq.z could
 	// be true if depth isn't constant but close enough. It also imply that
@@ -26,6 +26,7 @@
 #include "Renderers/SW/GSVertexSW.h"
 #include "Renderers/HW/GSVertexHW.h"
 #include "GSFunctionMap.h"
+#include "GSThread_CXX11.h"
 
 class GSState;
 
@@ -43,10 +44,28 @@ protected:
 
 	static GSVector4 s_minmax;
 
+	enum {PARALLEL_MIN_INDICES = 4096};
+
+	struct MinMax
+	{
+		GSVector4 tmin, tmax;
+		GSVector4i cmin, cmax;
+		#if _M_SSE >= 0x401
+		GSVector4i pmin, pmax;
+		#else
+		GSVector4 pmin, pmax;
+		#endif
+	};
+
+	GSWorkerPool* m_pool;
+
 	typedef void (GSVertexTrace::*FindMinMaxPtr)(const void* vertex, const uint32* index, int count);
 
 	FindMinMaxPtr m_fmm[2][2][2][2][2][4];
 
+	template<GS_PRIM_CLASS primclass, uint32 iip, uint32 tme, uint32 fst, uint32 color, uint32 accurate_stq>
+	static void FindMinMaxRange(MinMax& RESTRICT mm, const GSVertex* RESTRICT v, const uint32* RESTRICT index, int begin, int end);
+
 	template<GS_PRIM_CLASS primclass, uint32 iip, uint32 tme, uint32 fst, uint32 color, uint32 accurate_stq>
 	void FindMinMax(const void* vertex, const uint32* index, int count);
 
@@ -77,6 +96,8 @@ public:
 	GSVertexTrace(const GSState* state);
 	virtual ~GSVertexTrace() {}
 
+	void SetWorkerPool(GSWorkerPool* pool) {m_pool = pool;}
+
 	void Update(const void* vertex, const uint32* index, int v_count, int i_count, GS_PRIM_CLASS primclass);
 
 	bool IsLinear() const {return m_filter.opt_linear;}
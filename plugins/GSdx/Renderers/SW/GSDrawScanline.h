@@ -72,6 +72,9 @@ public:
 
 	void DrawRect(const GSVector4i& r, const GSVertexSW& v);
 
+	void Precompile(const GSJitKeys& keys);
+	void GetJitKeys(GSJitKeys& keys) const;
+
 #ifndef ENABLE_JIT_RASTERIZER
 	
 	void SetupPrim(const GSVertexSW* vertex, const uint32* index, const GSVertexSW& dscan);
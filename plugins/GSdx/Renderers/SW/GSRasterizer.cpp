@@ -133,6 +133,13 @@ int GSRasterizer::GetPixels(bool reset)
 
 void GSRasterizer::Draw(GSRasterizerData* data)
 {
+	if(data->jit_keys)
+	{
+		m_ds->Precompile(*data->jit_keys);
+
+		return;
+	}
+
 	GSPerfMonAutoTimer pmat(m_perfmon, GSPerfMon::WorkerDraw0 + m_id);
 
 	if(data->vertex != NULL && data->vertex_count == 0 || data->index != NULL && data->index_count == 0) return;
@@ -1202,6 +1209,36 @@ bool GSRasterizerList::IsSynced() const
 	return true;
 }
 
+void GSRasterizerList::Precompile(const std::shared_ptr<GSJitKeys>& keys)
+{
+	// every worker owns its code generators, the warm up runs on the worker threads ahead of the first draws
+
+	std::shared_ptr<GSRasterizerData> data(new GSRasterizerData());
+
+	data->jit_keys = keys;
+
+	for(size_t i = 0; i < m_workers.size(); i++)
+	{
+		m_workers[i]->Push(data);
+	}
+}
+
+void GSRasterizerList::GetJitKeys(GSJitKeys& keys)
+{
+	Sync();
+
+	for(size_t i = 0; i < m_r.size(); i++)
+	{
+		m_r[i]->GetJitKeys(keys);
+	}
+
+	std::sort(keys.sp.begin(), keys.sp.end());
+	keys.sp.erase(std::unique(keys.sp.begin(), keys.sp.end()), keys.sp.end());
+
+	std::sort(keys.ds.begin(), keys.ds.end());
+	keys.ds.erase(std::unique(keys.ds.begin(), keys.ds.end()), keys.ds.end());
+}
+
 int GSRasterizerList::GetPixels(bool reset)
 {
 	int pixels = 0;
@@ -28,6 +28,12 @@
 #include "GSPerfMon.h"
 #include "GSThread_CXX11.h"
 
+struct GSJitKeys
+{
+	std::vector<uint64> sp;
+	std::vector<uint64> ds;
+};
+
 class alignas(32) GSRasterizerData : public GSAlignedClass<32>
 {
 	static int s_counter;
@@ -45,6 +51,7 @@ public:
 	uint64 start;
 	int pixels;
 	int counter;
+	std::shared_ptr<GSJitKeys> jit_keys; // if set, only warm up the code generators
 
 	GSRasterizerData() 
 		: scissor(GSVector4i::zero())
@@ -104,6 +111,9 @@ public:
 	
 #endif
 
+	virtual void Precompile(const GSJitKeys& keys) = 0;
+	virtual void GetJitKeys(GSJitKeys& keys) const = 0;
+
 	virtual void PrintStats() = 0;
 
 	__forceinline bool HasEdge() const {return m_de != NULL;}
@@ -119,6 +129,8 @@ public:
 	virtual void Sync() = 0;
 	virtual bool IsSynced() const = 0;
 	virtual int GetPixels(bool reset = true) = 0;
+	virtual void Precompile(const std::shared_ptr<GSJitKeys>& keys) = 0;
+	virtual void GetJitKeys(GSJitKeys& keys) = 0;
 	virtual void PrintStats() = 0;
 };
 
@@ -175,6 +187,8 @@ public:
 	void Sync() {}
 	bool IsSynced() const {return true;}
 	int GetPixels(bool reset);
+	void Precompile(const std::shared_ptr<GSJitKeys>& keys) {m_ds->Precompile(*keys);}
+	void GetJitKeys(GSJitKeys& keys) {m_ds->GetJitKeys(keys);}
 	void PrintStats() {m_ds->PrintStats();}
 };
 
@@ -223,5 +237,7 @@ public:
 	void Sync();
 	bool IsSynced() const;
 	int GetPixels(bool reset);
+	void Precompile(const std::shared_ptr<GSJitKeys>& keys);
+	void GetJitKeys(GSJitKeys& keys);
 	void PrintStats() {}
 };
@@ -21,6 +21,7 @@
 
 #include "stdafx.h"
 #include "GSRendererSW.h"
+#include <fstream>
 
 #define LOG 0
 
@@ -51,6 +52,13 @@ GSRendererSW::GSRendererSW(int threads)
 
 	m_rl = GSRasterizerList::Create<GSDrawScanline>(threads, &m_perfmon);
 
+	if(threads > 0)
+	{
+		m_workers.reset(new GSWorkerPool(threads));
+
+		m_vt.SetWorkerPool(m_workers.get());
+	}
+
 	m_output = (uint8*)_aligned_malloc(1024 * 1024 * sizeof(uint32), 32);
 
 	for (uint32 i = 0; i < countof(m_fzb_pages); i++) {
@@ -87,6 +95,8 @@ GSRendererSW::GSRendererSW(int threads)
 
 GSRendererSW::~GSRendererSW()
 {
+	SaveJitCache();
+
 	delete m_tc;
 
 	for(size_t i = 0; i < countof(m_texture); i++)
@@ -96,9 +106,112 @@ GSRendererSW::~GSRendererSW()
 
 	delete m_rl;
 
+	m_vt.SetWorkerPool(NULL);
+
 	_aligned_free(m_output);
 }
 
+void GSRendererSW::SetGameCRC(uint32 crc, int options)
+{
+	if(crc == m_crc)
+	{
+		GSRenderer::SetGameCRC(crc, options);
+
+		return;
+	}
+
+	SaveJitCache();
+
+	GSRenderer::SetGameCRC(crc, options);
+
+	LoadJitCache();
+}
+
+std::string GSRendererSW::GetJitCachePath() const
+{
+	if(m_crc == 0 || !theApp.GetConfigB("jit_cache"))
+	{
+		return {};
+	}
+
+	std::string dir = theApp.GetConfigS("jit_cache_dir");
+
+	if(dir.empty())
+	{
+		dir = GStempdir() + "/GSdx_JitCache";
+	}
+
+	GSmkdir(dir.c_str());
+
+	// selector layout and generated code depend on the instruction set the plugin was built for
+
+	return dir + format("/%08X_%x.txt", m_crc, _M_SSE);
+}
+
+void GSRendererSW::LoadJitCache()
+{
+	std::string path = GetJitCachePath();
+
+	if(path.empty())
+	{
+		return;
+	}
+
+	std::ifstream file(path);
+
+	if(!file.is_open())
+	{
+		return;
+	}
+
+	std::shared_ptr<GSJitKeys> keys(new GSJitKeys());
+
+	std::string type;
+	uint64 key;
+
+	while(file >> type >> std::hex >> key)
+	{
+		if(type == "sp") keys->sp.push_back(key);
+		else if(type == "ds") keys->ds.push_back(key);
+	}
+
+	if(!keys->sp.empty() || !keys->ds.empty())
+	{
+		m_rl->Precompile(keys);
+	}
+}
+
+void GSRendererSW::SaveJitCache()
+{
+	std::string path = GetJitCachePath();
+
+	if(path.empty())
+	{
+		return;
+	}
+
+	GSJitKeys keys;
+
+	m_rl->GetJitKeys(keys);
+
+	if(keys.sp.empty() && keys.ds.empty())
+	{
+		return;
+	}
+
+	std::ofstream file(path);
+
+	if(!file.is_open())
+	{
+		return;
+	}
+
+	file << std::hex;
+
+	for(uint64 key : keys.sp) file << "sp " << key << "\n";
+	for(uint64 key : keys.ds) file << "ds " << key << "\n";
+}
+
 void GSRendererSW::Reset()
 {
 	Sync(-1);
@@ -223,7 +336,7 @@ void GSRendererSW::ConvertVertexBuffer(GSVertexSW* RESTRICT dst, const GSVertex*
 	GSVector8i o2((GSVector4i)m_context->XYOFFSET);
 	GSVector8 tsize2(GSVector4(0x10000 << m_context->TEX0.TW, 0x10000 << m_context->TEX0.TH, 1, 0));
 
-	for(int i = (int)m_vertex.next; i > 0; i -= 2, src += 2, dst += 2) // ok to overflow, allocator makes sure there is one more dummy vertex
+	for(int i = (int)count; i > 0; i -= 2, src += 2, dst += 2) // ok to overflow, allocator makes sure there is one more dummy vertex
 	{
 		GSVector8i v0 = GSVector8i::load<true>(src[0].m);
 		GSVector8i v1 = GSVector8i::load<true>(src[1].m);
@@ -287,7 +400,7 @@ void GSRendererSW::ConvertVertexBuffer(GSVertexSW* RESTRICT dst, const GSVertex*
 	GSVector4i off = (GSVector4i)m_context->XYOFFSET;
 	GSVector4 tsize = GSVector4(0x10000 << m_context->TEX0.TW, 0x10000 << m_context->TEX0.TH, 1, 0);
 
-	for(int i = (int)m_vertex.next; i > 0; i--, src++, dst++)
+	for(int i = (int)count; i > 0; i--, src++, dst++)
 	{
 		GSVector4 stcq = GSVector4::load<true>(&src->m[0]); // s t rgba q
 
@@ -392,7 +505,28 @@ void GSRendererSW::Draw()
 	// If you have both GS_SPRITE_CLASS && m_vt.m_eq.q, it will depends on the first part of the 'OR'
 	uint32 q_div = !IsMipMapActive() && ((m_vt.m_eq.q && m_vt.m_min.t.z != 1.0f) || (!m_vt.m_eq.q && m_vt.m_primclass == GS_SPRITE_CLASS));
 
-	(this->*m_cvb[m_vt.m_primclass][PRIM->TME][PRIM->FST][q_div])(sd->vertex, m_vertex.buff, m_vertex.next);
+	ConvertVertexBufferPtr cvb = m_cvb[m_vt.m_primclass][PRIM->TME][PRIM->FST][q_div];
+
+	{
+		GSPerfMonAutoTimer pmat(&m_perfmon, GSPerfMon::Prepass);
+
+		GSVertexSW* RESTRICT dst = sd->vertex;
+		const GSVertex* RESTRICT src = m_vertex.buff;
+
+		// sprite q_div looks at the vertex parity counted from the end, ranges must stay even
+
+		if(m_workers && (m_vertex.next & 1) == 0 && m_vertex.next >= PARALLEL_MIN_VERTICES * 2)
+		{
+			m_workers->Run(m_vertex.next, 2, PARALLEL_MIN_VERTICES, [&](int begin, int end)
+			{
+				(this->*cvb)(dst + begin, src + begin, end - begin);
+			});
+		}
+		else
+		{
+			(this->*cvb)(dst, src, m_vertex.next);
+		}
+	}
 
 	memcpy(sd->index, m_index.buff, sizeof(uint32) * m_index.tail);
 
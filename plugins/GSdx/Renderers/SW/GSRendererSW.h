@@ -60,6 +60,8 @@ class GSRendererSW : public GSRenderer
 		void UpdateSource();
 	};
 
+	enum {PARALLEL_MIN_VERTICES = 4096};
+
 	typedef void (GSRendererSW::*ConvertVertexBufferPtr)(GSVertexSW* RESTRICT dst, const GSVertex* RESTRICT src, size_t count);
 
 	ConvertVertexBufferPtr m_cvb[4][2][2][2];
@@ -69,6 +71,7 @@ class GSRendererSW : public GSRenderer
 
 protected:
 	IRasterizer* m_rl;
+	std::unique_ptr<GSWorkerPool> m_workers; // vertex conversion and trace of large draws
 	GSTextureCacheSW* m_tc;
 	GSTexture* m_texture[2];
 	uint8* m_output;
@@ -99,9 +102,15 @@ protected:
 
 	bool GetScanlineGlobalData(SharedData* data);
 
+	std::string GetJitCachePath() const;
+	void LoadJitCache();
+	void SaveJitCache();
+
 public:
 	static void InitVectors();
 
 	GSRendererSW(int threads);
 	virtual ~GSRendererSW();
+
+	void SetGameCRC(uint32 crc, int options);
 };
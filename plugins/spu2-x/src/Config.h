@@ -76,6 +76,8 @@ extern float VolumeAdjustSRdb;
 extern float VolumeAdjustLFEdb;
 extern bool postprocess_filter_enabled;
 extern bool postprocess_filter_dealias;
+extern bool BlockMixing;
+extern bool ThreadedMixing;
 
 extern int dplLevel;
 
@@ -106,23 +106,29 @@ void V_Core::AutoDMAReadBuffer(int mode) //mode: 0= split stereo; 1 = do not spl
     // addressing, but new PCSX2s have dynamic memory addressing).
 
     if (mode) {
-        if (DMAPtr != NULL)
+        if (DMAPtr != NULL) {
             //memcpy((ADMATempBuffer+(spos<<1)),DMAPtr+InputDataProgress,0x400);
+            InvalidatePcmCache(0x2000 + (Index << 10) + spos, 0x2000 + (Index << 10) + spos + 0x200);
             memcpy(GetMemPtr(0x2000 + (Index << 10) + spos), DMAPtr + InputDataProgress, 0x400);
+        }
         MADR += 0x400;
         InputDataLeft -= 0x200;
         InputDataProgress += 0x200;
     } else {
-        if (DMAPtr != NULL)
+        if (DMAPtr != NULL) {
             //memcpy((ADMATempBuffer+spos),DMAPtr+InputDataProgress,0x200);
+            InvalidatePcmCache(0x2000 + (Index << 10) + spos, 0x2000 + (Index << 10) + spos + 0x100);
             memcpy(GetMemPtr(0x2000 + (Index << 10) + spos), DMAPtr + InputDataProgress, 0x200);
+        }
         MADR += 0x200;
         InputDataLeft -= 0x100;
         InputDataProgress += 0x100;
 
-        if (DMAPtr != NULL)
+        if (DMAPtr != NULL) {
             //memcpy((ADMATempBuffer+spos+0x200),DMAPtr+InputDataProgress,0x200);
+            InvalidatePcmCache(0x2200 + (Index << 10) + spos, 0x2200 + (Index << 10) + spos + 0x100);
             memcpy(GetMemPtr(0x2200 + (Index << 10) + spos), DMAPtr + InputDataProgress, 0x200);
+        }
         MADR += 0x200;
         InputDataLeft -= 0x100;
         InputDataProgress += 0x100;
@@ -220,15 +226,7 @@ void V_Core::PlainDMAWrite(u16 *pMem, u32 size)
         buff1end = 0x100000;
     }
 
-    const int cacheIdxStart = TSA / pcm_WordsPerBlock;
-    const int cacheIdxEnd = (buff1end + pcm_WordsPerBlock - 1) / pcm_WordsPerBlock;
-    PcmCacheEntry *cacheLine = &pcm_cache_data[cacheIdxStart];
-    PcmCacheEntry &cacheEnd = pcm_cache_data[cacheIdxEnd];
-
-    do {
-        cacheLine->Validated = false;
-        cacheLine++;
-    } while (cacheLine != &cacheEnd);
+    InvalidatePcmCache(TSA, buff1end);
 
     //ConLog( "* SPU2-X: Cache Clear Range!  TSA=0x%x, TDA=0x%x (low8=0x%x, high8=0x%x, len=0x%x)\n",
     //	TSA, buff1end, flagTSA, flagTDA, clearLen );
@@ -246,10 +244,7 @@ void V_Core::PlainDMAWrite(u16 *pMem, u32 size)
         // second branch needs copied:
         // It starts at the beginning of memory and moves forward to buff2end
 
-        // endpoint cache should be irrelevant, since it's almost certainly dynamic
-        // memory below 0x2800 (registers and such)
-        //const u32 endpt2 = (buff2end + roundUp) / indexer_scalar;
-        //memset( pcm_cache_flags, 0, endpt2 );
+        InvalidatePcmCache(0, buff2end);
 
         // Emulation Grayarea: Should addresses wrap around to zero, or wrap around to
         // 0x2800?  Hard to know for sure (almost no games depend on this)
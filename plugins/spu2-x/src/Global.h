@@ -40,6 +40,7 @@ class SoundTouch;
 #include <cmath>
 #include <ctime>
 #include <stdexcept>
+#include <atomic>
 
 #include "Utilities/Dependencies.h"
 #include "Pcsx2Defs.h"
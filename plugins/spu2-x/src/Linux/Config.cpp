@@ -70,6 +70,8 @@ unsigned int delayCycles;
 
 bool postprocess_filter_enabled = true;
 bool postprocess_filter_dealias = false;
+bool BlockMixing = true;
+bool ThreadedMixing = false;
 bool _visual_debug_enabled = false; // windows only feature
 
 // OUTPUT
@@ -99,6 +101,8 @@ void ReadSettings()
     Interpolation = CfgReadInt(L"MIXING", L"Interpolation", 4);
     EffectsDisabled = CfgReadBool(L"MIXING", L"Disable_Effects", false);
     postprocess_filter_dealias = CfgReadBool(L"MIXING", L"DealiasFilter", false);
+    BlockMixing = CfgReadBool(L"MIXING", L"BlockMixing", true);
+    ThreadedMixing = CfgReadBool(L"MIXING", L"ThreadedMixing", false);
     FinalVolume = ((float)CfgReadInt(L"MIXING", L"FinalVolume", 100)) / 100;
     if (FinalVolume > 1.0f)
         FinalVolume = 1.0f;
@@ -198,6 +202,8 @@ void WriteSettings()
     CfgWriteInt(L"MIXING", L"Interpolation", Interpolation);
     CfgWriteBool(L"MIXING", L"Disable_Effects", EffectsDisabled);
     CfgWriteBool(L"MIXING", L"DealiasFilter", postprocess_filter_dealias);
+    CfgWriteBool(L"MIXING", L"BlockMixing", BlockMixing);
+    CfgWriteBool(L"MIXING", L"ThreadedMixing", ThreadedMixing);
     CfgWriteInt(L"MIXING", L"FinalVolume", (int)(FinalVolume * 100 + 0.5f));
 
     CfgWriteBool(L"MIXING", L"AdvancedVolumeControl", AdvancedVolumeControl);
@@ -0,0 +1,263 @@
+/* SPU2-X, A plugin for Emulating the Sound Processing Unit of the Playstation 2
+ * Developed and maintained by the Pcsx2 Development Team.
+ *
+ * SPU2-X is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Found-
+ * ation, either version 3 of the License, or (at your option) any later version.
+ *
+ * SPU2-X is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with SPU2-X.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Global.h"
+#include "PS2E-spu2.h"
+#include "MixThread.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include "Utilities/boost_spsc_queue.hpp"
+
+namespace MixThread
+{
+enum CommandType {
+    Cmd_Async = 0,
+    Cmd_Write,
+    Cmd_WriteDMA,
+    Cmd_InterruptDMA,
+};
+
+struct Command
+{
+    u8 type;
+    u8 core;
+    u16 value;
+    u32 clocks;
+    u32 arg; // register address, or DMA size in 16 bit units
+    u16 *mem;
+};
+
+// Plenty for a frame's worth of register writes; the producer yields when it is full.
+static const int RingSize = 0x4000;
+
+enum PendingCallback {
+    Pending_Irq = 1,
+    Pending_DMA4 = 2,
+    Pending_DMA7 = 4,
+};
+
+static ringbuffer_base<Command, RingSize> *s_ring = NULL;
+static std::thread s_thread;
+static bool s_active = false;
+
+// Written by the IOP thread only.
+static u32 s_pushed = 0;
+static u32 s_clocks = 0;
+
+// Written by the mixing thread only.
+static std::atomic<u32> s_processed(0);
+static std::atomic<u32> s_mixed_clocks(0);
+
+static std::atomic<u32> s_pending(0);
+static std::atomic<bool> s_sleeping(false);
+static bool s_exit = false;
+static std::mutex s_lock;
+static std::condition_variable s_notempty;
+
+// The IOP's callbacks, swapped out for the deferring ones below while the thread runs.
+static void (*s_irqcallback)() = NULL;
+static void (*s_dma4callback)() = NULL;
+static void (*s_dma7callback)() = NULL;
+
+static void DeferIrq() { s_pending.fetch_or(Pending_Irq); }
+static void DeferDMA4() { s_pending.fetch_or(Pending_DMA4); }
+static void DeferDMA7() { s_pending.fetch_or(Pending_DMA7); }
+
+struct Executor
+{
+    void operator()(const Command &cmd)
+    {
+        switch (cmd.type) {
+            case Cmd_Async:
+                TimeUpdate(cmd.clocks);
+                break;
+
+            case Cmd_Write:
+                TimeUpdate(cmd.clocks);
+                SPU2_WriteReg(cmd.arg, cmd.value);
+                break;
+
+            case Cmd_WriteDMA:
+                TimeUpdate(cmd.clocks);
+                SPU2_WriteDMA(cmd.core, cmd.mem, cmd.arg);
+                break;
+
+            case Cmd_InterruptDMA:
+                SPU2_InterruptDMA(cmd.core);
+                break;
+
+                jNO_DEFAULT;
+        }
+    }
+};
+
+static void ThreadProc()
+{
+    Executor exec;
+
+    while (true) {
+        while (s_ring->consume_one(exec)) {
+            s_mixed_clocks.store(lClocks, std::memory_order_release);
+            s_processed.fetch_add(1, std::memory_order_release);
+        }
+
+        std::unique_lock<std::mutex> l(s_lock);
+        s_sleeping.store(true);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        while (s_ring->empty() && !s_exit)
+            s_notempty.wait(l);
+
+        s_sleeping.store(false);
+        if (s_exit && s_ring->empty())
+            return;
+    }
+}
+
+static void Push(const Command &cmd)
+{
+    while (!s_ring->push(cmd))
+        std::this_thread::yield();
+
+    s_pushed++;
+
+    // Pairs with the fence in ThreadProc: either the thread sees the command before it
+    // sleeps, or we see it sleeping and wake it.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (s_sleeping.load()) {
+        {
+            std::lock_guard<std::mutex> l(s_lock);
+        }
+        s_notempty.notify_one();
+    }
+}
+
+void Open()
+{
+    if (s_active)
+        return;
+
+    s_irqcallback = _irqcallback;
+    s_dma4callback = dma4callback;
+    s_dma7callback = dma7callback;
+    _irqcallback = DeferIrq;
+    dma4callback = DeferDMA4;
+    dma7callback = DeferDMA7;
+
+    s_ring = new ringbuffer_base<Command, RingSize>();
+    s_pushed = 0;
+    s_processed = 0;
+    s_pending = 0;
+    s_clocks = lClocks;
+    s_mixed_clocks = lClocks;
+    s_exit = false;
+
+    s_thread = std::thread(ThreadProc);
+    s_active = true;
+
+    ConLog("* SPU2-X: Mixing on a dedicated thread.\n");
+}
+
+void Close()
+{
+    if (!s_active)
+        return;
+
+    {
+        std::lock_guard<std::mutex> l(s_lock);
+        s_exit = true;
+    }
+    s_notempty.notify_one();
+    s_thread.join();
+
+    s_active = false;
+    safe_delete(s_ring);
+
+    _irqcallback = s_irqcallback;
+    dma4callback = s_dma4callback;
+    dma7callback = s_dma7callback;
+
+    DeliverCallbacks();
+}
+
+bool IsActive()
+{
+    return s_active;
+}
+
+void SetCallbacks(void (*irq)(), void (*dma4)(), void (*dma7)())
+{
+    s_irqcallback = irq;
+    s_dma4callback = dma4;
+    s_dma7callback = dma7;
+}
+
+void Async(u32 clocks)
+{
+    Push({Cmd_Async, 0, 0, clocks, 0, NULL});
+    s_clocks = clocks;
+
+    // Don't let the output fall too far behind the emulated time; this also bounds how
+    // late IRQs and DMA completions reach the IOP.
+    while (s_processed.load(std::memory_order_acquire) != s_pushed &&
+           (s32)(s_clocks - s_mixed_clocks.load(std::memory_order_acquire)) > (s32)MaxLagClocks)
+        std::this_thread::yield();
+
+    DeliverCallbacks();
+}
+
+void Write(u32 rmem, u16 value, u32 clocks)
+{
+    Push({Cmd_Write, 0, value, clocks, rmem, NULL});
+}
+
+void WriteDMA(int core, u16 *pMem, u32 size, u32 clocks)
+{
+    // No copy: the IOP doesn't reuse the source before the DMA completion callback,
+    // which the mixing thread only raises after it has consumed this command.
+    Push({Cmd_WriteDMA, (u8)core, 0, clocks, size, pMem});
+}
+
+void InterruptDMA(int core)
+{
+    Push({Cmd_InterruptDMA, (u8)core, 0, 0, 0, NULL});
+}
+
+void Sync()
+{
+    while (s_processed.load(std::memory_order_acquire) != s_pushed)
+        std::this_thread::yield();
+
+    DeliverCallbacks();
+}
+
+void DeliverCallbacks()
+{
+    const u32 pending = s_pending.exchange(0);
+    if (!pending)
+        return;
+
+    if ((pending & Pending_Irq) && s_irqcallback)
+        s_irqcallback();
+    if ((pending & Pending_DMA4) && s_dma4callback)
+        s_dma4callback();
+    if ((pending & Pending_DMA7) && s_dma7callback)
+        s_dma7callback();
+}
+}
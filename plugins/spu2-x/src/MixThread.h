@@ -0,0 +1,49 @@
+/* SPU2-X, A plugin for Emulating the Sound Processing Unit of the Playstation 2
+ * Developed and maintained by the Pcsx2 Development Team.
+ *
+ * SPU2-X is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Found-
+ * ation, either version 3 of the License, or (at your option) any later version.
+ *
+ * SPU2-X is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with SPU2-X.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+// Threaded mixing (MIXING/ThreadedMixing in the ini):
+//  Register writes, DMA writes and clock advances from the IOP are queued in a single
+//  producer/single consumer ring and replayed in order by a dedicated thread, which owns
+//  all of the SPU2 state while it runs.  Anything that reads that state back (register
+//  and DMA reads, MADR, savestates, reset) first waits for the ring to drain.
+//
+//  IRQ and DMA completion callbacks raised by the mixing thread are held and delivered
+//  on the IOP thread on its next SPU2async or sync, so they arrive up to MaxLagClocks
+//  later than they would when mixing inline.
+
+namespace MixThread
+{
+// How far, in IOP cycles, the mixer is allowed to trail the IOP before SPU2async blocks.
+// 2ms of output (96 samples at 768 cycles each).
+static const u32 MaxLagClocks = 768 * 96;
+
+extern void Open();
+extern void Close();
+extern bool IsActive();
+
+extern void SetCallbacks(void (*irq)(), void (*dma4)(), void (*dma7)());
+
+extern void Async(u32 clocks);
+extern void Write(u32 rmem, u16 value, u32 clocks);
+extern void WriteDMA(int core, u16 *pMem, u32 size, u32 clocks);
+extern void InterruptDMA(int core);
+
+// Waits until the mixing thread has processed every queued command, then delivers any
+// callbacks it raised.
+extern void Sync();
+extern void DeliverCallbacks();
+}
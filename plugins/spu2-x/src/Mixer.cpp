@@ -16,6 +16,11 @@
  */
 
 #include "Global.h"
+#include "Spu2replay.h"
+
+#if defined(__SSE4_1__) || defined(__AVX2__)
+#include <immintrin.h>
+#endif
 
 // Games have turned out to be surprisingly sensitive to whether a parked, silent voice is being fully emulated.
 // With Silent Hill: Shattered Memories requiring full processing for no obvious reason, we've decided to
@@ -133,9 +138,7 @@ static void __forceinline IncrementNextA(V_Core &thiscore, uint voiceidx)
 // invalided when DMA transfers and memory writes are performed.
 PcmCacheEntry *pcm_cache_data = NULL;
 
-int g_counter_cache_hits = 0;
-int g_counter_cache_misses = 0;
-int g_counter_cache_ignores = 0;
+PcmCacheStats pcm_cache_stats;
 
 // LOOP/END sets the ENDX bit and sets NAX to LSA, and the voice is muted if LOOP is not set
 // LOOP seems to only have any effect on the block with LOOP/END set, where it prevents muting the voice
@@ -199,19 +202,10 @@ static __forceinline s32 GetNextDataBuffered(V_Core &thiscore, uint voiceidx)
 
             //ConLog( "* SPU2-X: Cache Hit! NextA=0x%x, cacheIdx=0x%x\n", vc.NextA, cacheIdx );
 
-            if (IsDevBuild)
-                g_counter_cache_hits++;
+            pcm_cache_stats.Hits++;
         } else {
-            // Only flag the cache if it's a non-dynamic memory range.
-            if (vc.NextA >= SPU2_DYN_MEMLINE)
-                cacheLine.Validated = true;
-
-            if (IsDevBuild) {
-                if (vc.NextA < SPU2_DYN_MEMLINE)
-                    g_counter_cache_ignores++;
-                else
-                    g_counter_cache_misses++;
-            }
+            cacheLine.Validated = true;
+            pcm_cache_stats.Misses++;
 
             XA_decode_block(vc.SBuffer, memptr, vc.Prev1, vc.Prev2);
         }
@@ -255,14 +249,14 @@ static __forceinline void GetNextDataDummy(V_Core &thiscore, uint voiceidx)
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
 
+static u16 NoiseLfsr = 0xC0FEu;
+
 static s32 __forceinline GetNoiseValues()
 {
-    static u16 lfsr = 0xC0FEu;
-
-    u16 bit = lfsr ^ (lfsr << 3) ^ (lfsr << 4) ^ (lfsr << 5);
-    lfsr = (lfsr << 1) | (bit >> 15);
+    u16 bit = NoiseLfsr ^ (NoiseLfsr << 3) ^ (NoiseLfsr << 4) ^ (NoiseLfsr << 5);
+    NoiseLfsr = (NoiseLfsr << 1) | (bit >> 15);
 
-    return (s16)lfsr;
+    return (s16)NoiseLfsr;
 }
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -291,7 +285,8 @@ static __forceinline StereoOut32 ApplyVolume(const StereoOut32 &data, const V_Vo
         ApplyVolume(data.Right, volume.Right.Value));
 }
 
-static void __forceinline UpdatePitch(uint coreidx, uint voiceidx)
+// modulator is the OutX of the previous voice for the current sample.
+static void __forceinline UpdatePitch(uint coreidx, uint voiceidx, s32 modulator)
 {
     V_Voice &vc(Cores[coreidx].Voices[voiceidx]);
     s32 pitch;
@@ -303,7 +298,7 @@ static void __forceinline UpdatePitch(uint coreidx, uint voiceidx)
     if ((vc.Modulated == 0) || (voiceidx == 0))
         pitch = vc.Pitch;
     else
-        pitch = GetClamped((vc.Pitch * (32768 + Cores[coreidx].Voices[voiceidx - 1].OutX)) >> 15, 0, 0x3fff);
+        pitch = GetClamped((vc.Pitch * (32768 + modulator)) >> 15, 0, 0x3fff);
 
     vc.SP += pitch;
 }
@@ -400,11 +395,11 @@ __forceinline static s32 CubicInterpolate(
     return (val + (y1 << 1));
 }
 
-// Returns a 16 bit result in Value.
+// Advances the voice to the current sample position, decoding as many samples as needed.
 // Uses standard template-style optimization techniques to statically generate five different
 // versions of this function (one for each type of interpolation).
 template <int InterpType>
-static __forceinline s32 GetVoiceValues(V_Core &thiscore, uint voiceidx)
+static __forceinline void GetVoiceValues(V_Core &thiscore, uint voiceidx)
 {
     V_Voice &vc(thiscore.Voices[voiceidx]);
 
@@ -417,21 +412,26 @@ static __forceinline s32 GetVoiceValues(V_Core &thiscore, uint voiceidx)
         vc.PV1 = GetNextDataBuffered(thiscore, voiceidx);
         vc.SP -= 4096;
     }
+}
 
-    const s32 mu = vc.SP + 4096;
+// Returns a 16 bit result in Value.
+template <int InterpType>
+static __forceinline s32 InterpolateVoiceValue(s32 PV4, s32 PV3, s32 PV2, s32 PV1, s32 SP)
+{
+    const s32 mu = SP + 4096;
 
     switch (InterpType) {
         case 0:
-            return vc.PV1 << 1;
+            return PV1 << 1;
         case 1:
-            return (vc.PV1 << 1) - (((vc.PV2 - vc.PV1) * vc.SP) >> 11);
+            return (PV1 << 1) - (((PV2 - PV1) * SP) >> 11);
 
         case 2:
-            return CubicInterpolate(vc.PV4, vc.PV3, vc.PV2, vc.PV1, mu);
+            return CubicInterpolate(PV4, PV3, PV2, PV1, mu);
         case 3:
-            return HermiteInterpolate<16384>(vc.PV4, vc.PV3, vc.PV2, vc.PV1, mu);
+            return HermiteInterpolate<16384>(PV4, PV3, PV2, PV1, mu);
         case 4:
-            return CatmullRomInterpolate(vc.PV4, vc.PV3, vc.PV2, vc.PV1, mu);
+            return CatmullRomInterpolate(PV4, PV3, PV2, PV1, mu);
 
             jNO_DEFAULT;
     }
@@ -466,8 +466,7 @@ static __forceinline s32 GetNoiseValues(V_Core &thiscore, uint voiceidx)
 //                                                                                     //
 
 // writes a signed value to the SPU2 ram
-// Performs no cache invalidation -- use only for dynamic memory ranges
-// of the SPU2 (between 0x0000 and SPU2_DYN_MEMLINE)
+// Use only for dynamic memory ranges of the SPU2 (between 0x0000 and SPU2_DYN_MEMLINE)
 static __forceinline void spu2M_WriteFast(u32 addr, s16 value)
 {
     // Fixes some of the oldest hangs in pcsx2's history! :p
@@ -481,11 +480,33 @@ static __forceinline void spu2M_WriteFast(u32 addr, s16 value)
 #ifndef DEBUG_FAST
     pxAssume(addr < SPU2_DYN_MEMLINE);
 #endif
+    InvalidatePcmCache(addr);
     *GetMemPtr(addr) = value;
 }
 
 
-static __forceinline StereoOut32 MixVoice(uint coreidx, uint voiceidx)
+// Per sample inputs of the interpolation, envelope and volume stages, one array per field so that
+// these stages run on all the voices of a core at once. Everything that has side effects (sample
+// decoding, IRQs, ENDX, ADSR, modulation) still runs voice by voice in PrepareVoice.
+struct VoiceMixLanes
+{
+    alignas(32) s32 PV4[V_Core::NumVoices];
+    alignas(32) s32 PV3[V_Core::NumVoices];
+    alignas(32) s32 PV2[V_Core::NumVoices];
+    alignas(32) s32 PV1[V_Core::NumVoices];
+    alignas(32) s32 SP[V_Core::NumVoices];
+    alignas(32) s32 NoiseMask[V_Core::NumVoices]; // -1 selects NoiseValue instead of the interpolated value
+    alignas(32) s32 NoiseValue[V_Core::NumVoices];
+    alignas(32) s32 ADSR[V_Core::NumVoices];
+    alignas(32) s32 VolL[V_Core::NumVoices];
+    alignas(32) s32 VolR[V_Core::NumVoices];
+    alignas(32) s32 DryL[V_Core::NumVoices];
+    alignas(32) s32 DryR[V_Core::NumVoices];
+    alignas(32) s32 WetL[V_Core::NumVoices];
+    alignas(32) s32 WetR[V_Core::NumVoices];
+};
+
+static __forceinline void PrepareVoice(uint coreidx, uint voiceidx, VoiceMixLanes &lanes, s16 outpos, s32 modulator)
 {
     V_Core &thiscore(Cores[coreidx]);
     V_Voice &vc(thiscore.Voices[voiceidx]);
@@ -500,51 +521,66 @@ static __forceinline StereoOut32 MixVoice(uint coreidx, uint voiceidx)
 
     vc.Volume.Update();
 
+    lanes.DryL[voiceidx] = thiscore.VoiceGates[voiceidx].DryL;
+    lanes.DryR[voiceidx] = thiscore.VoiceGates[voiceidx].DryR;
+    lanes.WetL[voiceidx] = thiscore.VoiceGates[voiceidx].WetL;
+    lanes.WetR[voiceidx] = thiscore.VoiceGates[voiceidx].WetR;
+
     // SPU2 Note: The spu2 continues to process voices for eternity, always, so we
     // have to run through all the motions of updating the voice regardless of it's
     // audible status.  Otherwise IRQs might not trigger and emulation might fail.
 
     if (vc.ADSR.Phase > 0) {
-        UpdatePitch(coreidx, voiceidx);
-
-        s32 Value = 0;
+        UpdatePitch(coreidx, voiceidx, modulator);
 
-        if (vc.Noise)
-            Value = GetNoiseValues(thiscore, voiceidx);
-        else {
+        if (vc.Noise) {
+            lanes.NoiseMask[voiceidx] = -1;
+            lanes.NoiseValue[voiceidx] = GetNoiseValues(thiscore, voiceidx);
+        } else {
             // Optimization : Forceinline'd Templated Dispatch Table.  Any halfwit compiler will
             // turn this into a clever jump dispatch table (no call/rets, no compares, uber-efficient!)
 
             switch (Interpolation) {
                 case 0:
-                    Value = GetVoiceValues<0>(thiscore, voiceidx);
+                    GetVoiceValues<0>(thiscore, voiceidx);
                     break;
                 case 1:
-                    Value = GetVoiceValues<1>(thiscore, voiceidx);
+                    GetVoiceValues<1>(thiscore, voiceidx);
                     break;
                 case 2:
-                    Value = GetVoiceValues<2>(thiscore, voiceidx);
+                    GetVoiceValues<2>(thiscore, voiceidx);
                     break;
                 case 3:
-                    Value = GetVoiceValues<3>(thiscore, voiceidx);
+                    GetVoiceValues<3>(thiscore, voiceidx);
                     break;
                 case 4:
-                    Value = GetVoiceValues<4>(thiscore, voiceidx);
+                    GetVoiceValues<4>(thiscore, voiceidx);
                     break;
 
                     jNO_DEFAULT;
             }
+
+            lanes.NoiseMask[voiceidx] = 0;
+            lanes.NoiseValue[voiceidx] = 0;
         }
 
-        // Update and Apply ADSR  (applies to normal and noise sources)
+        lanes.PV4[voiceidx] = vc.PV4;
+        lanes.PV3[voiceidx] = vc.PV3;
+        lanes.PV2[voiceidx] = vc.PV2;
+        lanes.PV1[voiceidx] = vc.PV1;
+        lanes.SP[voiceidx] = vc.SP;
+
+        // Update ADSR (applies to normal and noise sources), the value is applied in MixLanes
         //
         // Note!  It's very important that ADSR stay as accurate as possible.  By the way
         // it is used, various sound effects can end prematurely if we truncate more than
         // one or two bits.  Best result comes from no truncation at all, which is why we
-        // use a full 64-bit multiply/result here.
+        // use a full 64-bit multiply/result there.
 
         CalculateADSR(thiscore, voiceidx);
-        Value = MulShr32(Value, vc.ADSR.Value);
+        lanes.ADSR[voiceidx] = vc.ADSR.Value;
+        lanes.VolL[voiceidx] = vc.Volume.Left.Value;
+        lanes.VolR[voiceidx] = vc.Volume.Right.Value;
 
         // Store Value for eventual modulation later
         // Pseudonym's Crest calculation idea. Actually calculates a crest, unlike the old code which was just peak.
@@ -562,18 +598,16 @@ static __forceinline StereoOut32 MixVoice(uint coreidx, uint voiceidx)
         // Write-back of raw voice data (post ADSR applied)
 
         if (voiceidx == 1)
-            spu2M_WriteFast(((0 == coreidx) ? 0x400 : 0xc00) + OutPos, vc.OutX);
+            spu2M_WriteFast(((0 == coreidx) ? 0x400 : 0xc00) + outpos, vc.OutX);
         else if (voiceidx == 3)
-            spu2M_WriteFast(((0 == coreidx) ? 0x600 : 0xe00) + OutPos, vc.OutX);
-
-        return ApplyVolume(StereoOut32(Value, Value), vc.Volume);
+            spu2M_WriteFast(((0 == coreidx) ? 0x600 : 0xe00) + outpos, vc.OutX);
     } else {
         // Continue processing voice, even if it's "off". Or else we miss interrupts! (Fatal Frame engine died because of this.)
         if (NEVER_SKIP_VOICES || (*GetMemPtr(vc.NextA & 0xFFFF8) >> 8 & 3) != 3 || vc.LoopStartA != (vc.NextA & ~7)    // not in a tight loop
             || (Cores[0].IRQEnable && (Cores[0].IRQA & ~7) == vc.LoopStartA)                                           // or should be interrupting regularly
             || (Cores[1].IRQEnable && (Cores[1].IRQA & ~7) == vc.LoopStartA) || !(thiscore.Regs.ENDX & 1 << voiceidx)) // or isn't currently flagged as having passed the endpoint
         {
-            UpdatePitch(coreidx, voiceidx);
+            UpdatePitch(coreidx, voiceidx, modulator);
 
             while (vc.SP > 0)
                 GetNextDataDummy(thiscore, voiceidx); // Dummy is enough
@@ -581,30 +615,519 @@ static __forceinline StereoOut32 MixVoice(uint coreidx, uint voiceidx)
 
         // Write-back of raw voice data (some zeros since the voice is "dead")
         if (voiceidx == 1)
-            spu2M_WriteFast(((0 == coreidx) ? 0x400 : 0xc00) + OutPos, 0);
+            spu2M_WriteFast(((0 == coreidx) ? 0x400 : 0xc00) + outpos, 0);
         else if (voiceidx == 3)
-            spu2M_WriteFast(((0 == coreidx) ? 0x600 : 0xe00) + OutPos, 0);
+            spu2M_WriteFast(((0 == coreidx) ? 0x600 : 0xe00) + outpos, 0);
 
-        return StereoOut32(0, 0);
+        // A zero envelope and volume mix the voice as silence.
+        lanes.PV4[voiceidx] = lanes.PV3[voiceidx] = lanes.PV2[voiceidx] = lanes.PV1[voiceidx] = 0;
+        lanes.SP[voiceidx] = 0;
+        lanes.NoiseMask[voiceidx] = lanes.NoiseValue[voiceidx] = 0;
+        lanes.ADSR[voiceidx] = lanes.VolL[voiceidx] = lanes.VolR[voiceidx] = 0;
     }
 }
 
+#if defined(__AVX2__) || defined(__SSE4_1__)
+
+#if defined(__AVX2__)
+
+struct MixSimd
+{
+    typedef __m256i V;
+    enum { Lanes = 8 };
+
+    static __forceinline V load(const s32 *p) { return _mm256_load_si256((const V *)p); }
+    static __forceinline void store(s32 *p, V a) { _mm256_store_si256((V *)p, a); }
+    static __forceinline V zero() { return _mm256_setzero_si256(); }
+    static __forceinline V add(V a, V b) { return _mm256_add_epi32(a, b); }
+    static __forceinline V sub(V a, V b) { return _mm256_sub_epi32(a, b); }
+    static __forceinline V mul(V a, V b) { return _mm256_mullo_epi32(a, b); }
+    static __forceinline V min(V a, V b) { return _mm256_min_epi32(a, b); }
+    static __forceinline V max(V a, V b) { return _mm256_max_epi32(a, b); }
+    static __forceinline V and_(V a, V b) { return _mm256_and_si256(a, b); }
+    static __forceinline V blend(V a, V b, V mask) { return _mm256_blendv_epi8(a, b, mask); }
+    static __forceinline V set1(s32 x) { return _mm256_set1_epi32(x); }
+    template <int n> static __forceinline V sra(V a) { return _mm256_srai_epi32(a, n); }
+    template <int n> static __forceinline V sll(V a) { return _mm256_slli_epi32(a, n); }
+
+    // (s64)a * b >> 32 per lane
+    static __forceinline V mulshr32(V a, V b)
+    {
+        V even = _mm256_srli_epi64(_mm256_mul_epi32(a, b), 32);
+        V odd = _mm256_mul_epi32(_mm256_srli_epi64(a, 32), _mm256_srli_epi64(b, 32));
+        return _mm256_blend_epi32(even, odd, 0xaa);
+    }
+
+    static __forceinline s32 hsum(V a)
+    {
+        __m128i x = _mm_add_epi32(_mm256_castsi256_si128(a), _mm256_extracti128_si256(a, 1));
+        x = _mm_add_epi32(x, _mm_shuffle_epi32(x, _MM_SHUFFLE(1, 0, 3, 2)));
+        x = _mm_add_epi32(x, _mm_shuffle_epi32(x, _MM_SHUFFLE(2, 3, 0, 1)));
+        return _mm_cvtsi128_si32(x);
+    }
+};
+
+#else
+
+struct MixSimd
+{
+    typedef __m128i V;
+    enum { Lanes = 4 };
+
+    static __forceinline V load(const s32 *p) { return _mm_load_si128((const V *)p); }
+    static __forceinline void store(s32 *p, V a) { _mm_store_si128((V *)p, a); }
+    static __forceinline V zero() { return _mm_setzero_si128(); }
+    static __forceinline V add(V a, V b) { return _mm_add_epi32(a, b); }
+    static __forceinline V sub(V a, V b) { return _mm_sub_epi32(a, b); }
+    static __forceinline V mul(V a, V b) { return _mm_mullo_epi32(a, b); }
+    static __forceinline V min(V a, V b) { return _mm_min_epi32(a, b); }
+    static __forceinline V max(V a, V b) { return _mm_max_epi32(a, b); }
+    static __forceinline V and_(V a, V b) { return _mm_and_si128(a, b); }
+    static __forceinline V blend(V a, V b, V mask) { return _mm_blendv_epi8(a, b, mask); }
+    static __forceinline V set1(s32 x) { return _mm_set1_epi32(x); }
+    template <int n> static __forceinline V sra(V a) { return _mm_srai_epi32(a, n); }
+    template <int n> static __forceinline V sll(V a) { return _mm_slli_epi32(a, n); }
+
+    // (s64)a * b >> 32 per lane
+    static __forceinline V mulshr32(V a, V b)
+    {
+        V even = _mm_srli_epi64(_mm_mul_epi32(a, b), 32);
+        V odd = _mm_mul_epi32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+        return _mm_blend_epi16(even, odd, 0xcc);
+    }
+
+    static __forceinline s32 hsum(V x)
+    {
+        x = _mm_add_epi32(x, _mm_shuffle_epi32(x, _MM_SHUFFLE(1, 0, 3, 2)));
+        x = _mm_add_epi32(x, _mm_shuffle_epi32(x, _MM_SHUFFLE(2, 3, 0, 1)));
+        return _mm_cvtsi128_si32(x);
+    }
+};
+
+#endif
+
+// Same operations as the scalar interpolators, in the same order, so the results are bit-exact.
+template <int InterpType>
+static __forceinline MixSimd::V InterpolateVoiceValues(MixSimd::V y0, MixSimd::V y1, MixSimd::V y2, MixSimd::V y3, MixSimd::V sp)
+{
+    typedef MixSimd S;
+    typedef S::V V;
+
+    const V mu = S::add(sp, S::set1(4096));
+
+    switch (InterpType) {
+        case 0:
+            return S::sll<1>(y3);
+        case 1:
+            return S::sub(S::sll<1>(y3), S::sra<11>(S::mul(S::sub(y2, y3), sp)));
+
+        case 2: {
+            const V a0 = S::add(S::sub(S::sub(y3, y2), y0), y1);
+            const V a1 = S::sub(S::sub(y0, y1), a0);
+            const V a2 = S::sub(y2, y0);
+
+            V val = S::sra<12>(S::mul(a0, mu));
+            val = S::sra<12>(S::mul(S::add(val, a1), mu));
+            val = S::sra<11>(S::mul(S::add(val, a2), mu));
+
+            return S::add(val, S::sll<1>(y1));
+        }
+        case 3: {
+            const V tension = S::set1(16384);
+            const V m00 = S::sra<16>(S::mul(S::sub(y1, y0), tension));
+            const V m01 = S::sra<16>(S::mul(S::sub(y2, y1), tension));
+            const V m0 = S::add(m00, m01);
+            const V m10 = S::sra<16>(S::mul(S::sub(y2, y1), tension));
+            const V m11 = S::sra<16>(S::mul(S::sub(y3, y2), tension));
+            const V m1 = S::add(m10, m11);
+
+            V val = S::sra<12>(S::mul(S::sub(S::add(S::add(S::sll<1>(y1), m0), m1), S::sll<1>(y2)), mu));
+            val = S::sub(S::sub(S::sub(val, S::mul(y1, S::set1(3))), S::sll<1>(m0)), m1);
+            val = S::sra<12>(S::mul(S::add(val, S::mul(y2, S::set1(3))), mu));
+            val = S::sra<11>(S::mul(S::add(val, m0), mu));
+
+            return S::add(val, S::sll<1>(y1));
+        }
+        case 4: {
+            const V a3 = S::add(S::sub(S::add(S::sub(S::zero(), y0), S::mul(y1, S::set1(3))), S::mul(y2, S::set1(3))), y3);
+            const V a2 = S::sub(S::add(S::sub(S::sll<1>(y0), S::mul(y1, S::set1(5))), S::sll<2>(y2)), y3);
+            const V a1 = S::sub(y2, y0);
+            const V a0 = S::sll<1>(y1);
+
+            V val = S::sra<12>(S::mul(a3, mu));
+            val = S::sra<12>(S::mul(S::add(a2, val), mu));
+            val = S::sra<12>(S::mul(S::add(a1, val), mu));
+
+            return S::add(a0, val);
+        }
+
+            jNO_DEFAULT;
+    }
+
+    return S::zero();
+}
+
+template <int InterpType>
+static __forceinline void MixLanes(VoiceMixSet &dest, const VoiceMixLanes &lanes)
+{
+    typedef MixSimd S;
+    typedef S::V V;
+
+    V dryl = S::zero(), dryr = S::zero(), wetl = S::zero(), wetr = S::zero();
+
+    for (uint i = 0; i < V_Core::NumVoices; i += S::Lanes) {
+        V value = InterpolateVoiceValues<InterpType>(
+            S::load(&lanes.PV4[i]), S::load(&lanes.PV3[i]), S::load(&lanes.PV2[i]), S::load(&lanes.PV1[i]), S::load(&lanes.SP[i]));
+
+        value = S::blend(value, S::load(&lanes.NoiseValue[i]), S::load(&lanes.NoiseMask[i]));
+        value = S::mulshr32(value, S::load(&lanes.ADSR[i]));
+        value = S::sll<1>(value);
+
+        const V l = S::mulshr32(value, S::load(&lanes.VolL[i]));
+        const V r = S::mulshr32(value, S::load(&lanes.VolR[i]));
+
+        dryl = S::add(dryl, S::and_(l, S::load(&lanes.DryL[i])));
+        dryr = S::add(dryr, S::and_(r, S::load(&lanes.DryR[i])));
+        wetl = S::add(wetl, S::and_(l, S::load(&lanes.WetL[i])));
+        wetr = S::add(wetr, S::and_(r, S::load(&lanes.WetR[i])));
+    }
+
+    dest.Dry.Left += S::hsum(dryl);
+    dest.Dry.Right += S::hsum(dryr);
+    dest.Wet.Left += S::hsum(wetl);
+    dest.Wet.Right += S::hsum(wetr);
+}
+
+#else
+
+template <int InterpType>
+static __forceinline void MixLanes(VoiceMixSet &dest, const VoiceMixLanes &lanes)
+{
+    for (uint i = 0; i < V_Core::NumVoices; i++) {
+        s32 Value = lanes.NoiseMask[i] ? lanes.NoiseValue[i] :
+                                         InterpolateVoiceValue<InterpType>(lanes.PV4[i], lanes.PV3[i], lanes.PV2[i], lanes.PV1[i], lanes.SP[i]);
+
+        Value = MulShr32(Value, lanes.ADSR[i]);
+
+        StereoOut32 VVal(ApplyVolume(Value, lanes.VolL[i]), ApplyVolume(Value, lanes.VolR[i]));
+
+        // Note: Results from ApplyVolume are ranged at 16 bits.
+
+        dest.Dry.Left += VVal.Left & lanes.DryL[i];
+        dest.Dry.Right += VVal.Right & lanes.DryR[i];
+        dest.Wet.Left += VVal.Left & lanes.WetL[i];
+        dest.Wet.Right += VVal.Right & lanes.WetR[i];
+    }
+}
+
+#endif
+
 const VoiceMixSet VoiceMixSet::Empty((StereoOut32()), (StereoOut32())); // Don't use SteroOut32::Empty because C++ doesn't make any dep/order checks on global initializers.
 
+static __forceinline void MixCoreLanes(VoiceMixSet &dest, const VoiceMixLanes &lanes)
+{
+    switch (Interpolation) {
+        case 0:
+            MixLanes<0>(dest, lanes);
+            break;
+        case 1:
+            MixLanes<1>(dest, lanes);
+            break;
+        case 2:
+            MixLanes<2>(dest, lanes);
+            break;
+        case 3:
+            MixLanes<3>(dest, lanes);
+            break;
+        case 4:
+            MixLanes<4>(dest, lanes);
+            break;
+
+            jNO_DEFAULT;
+    }
+}
+
 static __forceinline void MixCoreVoices(VoiceMixSet &dest, const uint coreidx)
 {
-    V_Core &thiscore(Cores[coreidx]);
+    VoiceMixLanes lanes;
 
-    for (uint voiceidx = 0; voiceidx < V_Core::NumVoices; ++voiceidx) {
-        StereoOut32 VVal(MixVoice(coreidx, voiceidx));
+    for (uint voiceidx = 0; voiceidx < V_Core::NumVoices; ++voiceidx)
+        PrepareVoice(coreidx, voiceidx, lanes, OutPos, voiceidx ? Cores[coreidx].Voices[voiceidx - 1].OutX : 0);
 
-        // Note: Results from MixVoice are ranged at 16 bits.
+    MixCoreLanes(dest, lanes);
+}
+
+// ---------------------------------------------------------------------------------------
+//  ADPCM prefetch
+// ---------------------------------------------------------------------------------------
+// Decoding a block is a chain of dependent multiplies, so the blocks the playing voices are
+// about to read are decoded ahead of time into the PCM cache, several voices at once.
+// A voice decodes a block that isn't cached with the last two samples of the block before,
+// and takes the same two samples from the cache line when it is cached. So following each
+// voice block by block from where it is fills the cache with what the voice would have
+// decoded itself. The walk stops at a loop end, since the jump target can still change,
+// and skips the dynamic memory and the effects areas, which the mixer rewrites all the time.
+
+static const uint PcmPrefetchBlocks = 4;    // blocks decoded ahead of each voice
+static const uint PcmPrefetchInterval = 16; // samples between two walks
+
+struct PcmDecodeBatch
+{
+    uint Count;
+    const s16 *Block[V_Core::NumVoices * 2];
+    s16 *Dest[V_Core::NumVoices * 2];
+    s32 Prev1[V_Core::NumVoices * 2];
+    s32 Prev2[V_Core::NumVoices * 2];
+};
 
-        dest.Dry.Left += VVal.Left & thiscore.VoiceGates[voiceidx].DryL;
-        dest.Dry.Right += VVal.Right & thiscore.VoiceGates[voiceidx].DryR;
-        dest.Wet.Left += VVal.Left & thiscore.VoiceGates[voiceidx].WetL;
-        dest.Wet.Right += VVal.Right & thiscore.VoiceGates[voiceidx].WetR;
+#if defined(__AVX2__) || defined(__SSE4_1__)
+
+// XA_decode_block on one block per lane, with the same operations in the same order.
+static __forceinline void XA_decode_blocks(s16 *const *dest, const s16 *const *blocks, const s32 *prev1, const s32 *prev2)
+{
+    typedef MixSimd S;
+    typedef S::V V;
+
+    alignas(32) s32 data[pcm_DecodedSamplesPerBlock][S::Lanes];
+    alignas(32) s32 pcm[pcm_DecodedSamplesPerBlock][S::Lanes];
+    alignas(32) s32 pred1[S::Lanes];
+    alignas(32) s32 pred2[S::Lanes];
+    alignas(32) s32 p1[S::Lanes];
+    alignas(32) s32 p2[S::Lanes];
+
+    for (int lane = 0; lane < S::Lanes; lane++) {
+        const s32 header = *blocks[lane];
+        const s32 shift = (header & 0xF) + 16;
+        const int id = header >> 4 & 0xF;
+        if (id > 4 && MsgToConsole())
+            ConLog("* SPU2-X: Unknown ADPCM coefficients table id %d\n", id);
+        pred1[lane] = tbl_XA_Factor[id][0];
+        pred2[lane] = tbl_XA_Factor[id][1];
+        p1[lane] = prev1[lane];
+        p2[lane] = prev2[lane];
+
+        const s8 *blockbytes = (s8 *)&blocks[lane][1];
+        for (int i = 0; i < pcm_DecodedSamplesPerBlock / 2; i++) {
+            data[i * 2][lane] = (s32)((blockbytes[i] << 28) & 0xF0000000) >> shift;
+            data[i * 2 + 1][lane] = (s32)((blockbytes[i] << 24) & 0xF0000000) >> shift;
+        }
+    }
+
+    const V vpred1 = S::load(pred1);
+    const V vpred2 = S::load(pred2);
+    V vprev1 = S::load(p1);
+    V vprev2 = S::load(p2);
+
+    for (int i = 0; i < pcm_DecodedSamplesPerBlock; i++) {
+        V v = S::add(S::load(data[i]), S::sra<6>(S::add(S::add(S::mul(vpred1, vprev1), S::mul(vpred2, vprev2)), S::set1(32))));
+        v = S::min(S::max(v, S::set1(-0x8000)), S::set1(0x7fff));
+        S::store(pcm[i], v);
+
+        vprev2 = vprev1;
+        vprev1 = v;
+    }
+
+    for (int lane = 0; lane < S::Lanes; lane++)
+        for (int i = 0; i < pcm_DecodedSamplesPerBlock; i++)
+            dest[lane][i] = pcm[i][lane];
+}
+
+#endif
+
+static void DecodePcmBatch(PcmDecodeBatch &batch)
+{
+    uint i = 0;
+
+#if defined(__AVX2__) || defined(__SSE4_1__)
+    for (; i + MixSimd::Lanes <= batch.Count; i += MixSimd::Lanes)
+        XA_decode_blocks(&batch.Dest[i], &batch.Block[i], &batch.Prev1[i], &batch.Prev2[i]);
+#endif
+
+    for (; i < batch.Count; i++)
+        XA_decode_block(batch.Dest[i], batch.Block[i], batch.Prev1[i], batch.Prev2[i]);
+}
+
+static __forceinline bool CanPrefetchPcmBlock(u32 addr)
+{
+    if (addr < SPU2_DYN_MEMLINE)
+        return false;
+
+    for (int i = 0; i < 2; i++)
+        if (addr <= Cores[i].EffectsEndA && addr + 7 >= Cores[i].EffectsStartA)
+            return false;
+
+    return true;
+}
+
+static void PrefetchPcmBlocks()
+{
+    u32 next[V_Core::NumVoices * 2];
+    s32 prev1[V_Core::NumVoices * 2];
+    s32 prev2[V_Core::NumVoices * 2];
+    uint count = 0;
+
+    for (uint coreidx = 0; coreidx < 2; ++coreidx) {
+        for (uint voiceidx = 0; voiceidx < V_Core::NumVoices; ++voiceidx) {
+            const V_Voice &vc(Cores[coreidx].Voices[voiceidx]);
+
+            if (vc.ADSR.Phase == 0 || vc.Noise || (vc.LoopFlags & XAFLAG_LOOP_END))
+                continue;
+
+            // The block whose header is read when SCurrent wraps: NextA already points into
+            // it once the last word of the current block has been read.
+            next[count] = ((vc.NextA & 0xFFFF8) + (vc.SCurrent > 24 ? 0 : 8)) & 0xFFFFF;
+            prev1[count] = vc.Prev1;
+            prev2[count] = vc.Prev2;
+            count++;
+        }
+    }
+
+    for (uint depth = 0; depth < PcmPrefetchBlocks && count > 0; ++depth) {
+        PcmDecodeBatch batch;
+        batch.Count = 0;
+
+        for (uint i = 0; i < count;) {
+            if (!CanPrefetchPcmBlock(next[i])) {
+                --count;
+                next[i] = next[count];
+                prev1[i] = prev1[count];
+                prev2[i] = prev2[count];
+                continue;
+            }
+
+            PcmCacheEntry &cacheLine = pcm_cache_data[next[i] / pcm_WordsPerBlock];
+            if (!cacheLine.Validated) {
+                cacheLine.Validated = true;
+
+                batch.Block[batch.Count] = GetMemPtr(next[i]);
+                batch.Dest[batch.Count] = cacheLine.Sampledata;
+                batch.Prev1[batch.Count] = prev1[i];
+                batch.Prev2[batch.Count] = prev2[i];
+                batch.Count++;
+            }
+            i++;
+        }
+
+        DecodePcmBatch(batch);
+        pcm_cache_stats.Prefetched += batch.Count;
+
+        for (uint i = 0; i < count;) {
+            if ((*GetMemPtr(next[i]) >> 8) & XAFLAG_LOOP_END) {
+                --count;
+                next[i] = next[count];
+                prev1[i] = prev1[count];
+                prev2[i] = prev2[count];
+                continue;
+            }
+
+            const PcmCacheEntry &cacheLine = pcm_cache_data[next[i] / pcm_WordsPerBlock];
+            prev1[i] = cacheLine.Sampledata[27];
+            prev2[i] = cacheLine.Sampledata[26];
+            next[i] = (next[i] + pcm_WordsPerBlock) & 0xFFFFF;
+            i++;
+        }
+    }
+}
+
+// ---------------------------------------------------------------------------------------
+//  Block mixing
+// ---------------------------------------------------------------------------------------
+// Within a sample the voices only see each other through modulation (the OutX of the
+// previous voice), the shared noise generator, IRQs and SPU2 RAM. So when no voice uses
+// noise and none of them can read RAM that the mixer writes, the voices can be run voice
+// by voice over several samples instead of sample by sample without changing anything.
+// Mix() then consumes the prepared lanes one sample at a time, the core stage (ADMA input,
+// reverb, output) still runs in the original order. IRQs raised by the voices are kept
+// per sample and only signalled when Mix() reaches that sample, so that TimeUpdate calls
+// the IRQ callback on the same tick as before.
+
+extern bool has_to_call_irq;
+
+static const uint MixBlockMaxSamples = 32;
+
+// Words a voice can walk through within a block: the pitch is clamped to 0x3fff (less than
+// 4 samples per output sample), so 32 samples touch no more than 6 ADPCM blocks of 8 words.
+static const u32 MixBlockReach = 0x100;
+
+static VoiceMixLanes s_BlockLanes[MixBlockMaxSamples][2];
+static u16 s_BlockIrq[MixBlockMaxSamples]; // Spdif.Info IRQ bits raised by the voices
+static uint s_BlockPos = 0;
+static uint s_BlockLen = 0;
+
+static __forceinline bool BlockMayReadMixerWrites(u32 addr)
+{
+    const u32 start = addr & ~7;
+    const u32 end = start + MixBlockReach;
+
+    // Voice output, core output and ADMA buffers, and the end of the RAM where NextA wraps.
+    if (start < SPU2_DYN_MEMLINE || end > 0x100000)
+        return true;
+
+    for (int i = 0; i < 2; i++)
+        if (start <= Cores[i].EffectsEndA && end > Cores[i].EffectsStartA)
+            return true;
+
+    return false;
+}
+
+static bool CanMixVoiceBlock()
+{
+    for (int i = 0; i < 2; i++) {
+        // Reverb reading the voice output area would see samples from later in the block.
+        if (Cores[i].EffectsStartA < SPU2_DYN_MEMLINE)
+            return false;
+
+        for (uint voiceidx = 0; voiceidx < V_Core::NumVoices; ++voiceidx) {
+            const V_Voice &vc(Cores[i].Voices[voiceidx]);
+
+            if (vc.Noise || BlockMayReadMixerWrites(vc.NextA) || BlockMayReadMixerWrites(vc.LoopStartA))
+                return false;
+        }
+    }
+
+    return true;
+}
+
+// Runs the voices of both cores ahead over the next samples, up to MixBlockMaxSamples.
+// The caller guarantees that no register write, KeyOn or DMA interrupt happens within
+// these samples, each of them must then be followed by a call to Mix().
+void PrepareVoiceBlock(uint samples)
+{
+    if (s_BlockPos < s_BlockLen)
+        return;
+
+    ReplayStageTimer timer(ReplayStage_Voices);
+
+    samples = std::min(samples, MixBlockMaxSamples);
+    if (samples < 2 || !CanMixVoiceBlock())
+        return;
+
+    const u16 info = Spdif.Info;
+    const bool irq = has_to_call_irq;
+
+    memset(s_BlockIrq, 0, sizeof(s_BlockIrq));
+
+    for (uint coreidx = 0; coreidx < 2; ++coreidx) {
+        s32 modulator[MixBlockMaxSamples] = {};
+
+        for (uint voiceidx = 0; voiceidx < V_Core::NumVoices; ++voiceidx) {
+            const V_Voice &vc(Cores[coreidx].Voices[voiceidx]);
+
+            for (uint i = 0; i < samples; ++i) {
+                PrepareVoice(coreidx, voiceidx, s_BlockLanes[i][coreidx], (OutPos + i) & 0x1FF, modulator[i]);
+                modulator[i] = vc.OutX;
+
+                if (Spdif.Info != info) {
+                    s_BlockIrq[i] |= Spdif.Info & ~info;
+                    Spdif.Info = info;
+                    has_to_call_irq = irq;
+                }
+            }
+        }
     }
+
+    s_BlockPos = 0;
+    s_BlockLen = samples;
 }
 
 StereoOut32 V_Core::Mix(const VoiceMixSet &inVoices, const StereoOut32 &Input, const StereoOut32 &Ext)
@@ -684,7 +1207,11 @@ StereoOut32 V_Core::Mix(const VoiceMixSet &inVoices, const StereoOut32 &Input, c
 
     WaveDump::WriteCore(Index, CoreSrc_PreReverb, TW);
 
-    StereoOut32 RV = DoReverb(TW);
+    StereoOut32 RV;
+    {
+        ReplayStageTimer timer(ReplayStage_Reverb);
+        RV = DoReverb(TW);
+    }
 
     WaveDump::WriteCore(Index, CoreSrc_PostReverb, RV);
 
@@ -697,10 +1224,10 @@ StereoOut32 V_Core::Mix(const VoiceMixSet &inVoices, const StereoOut32 &Input, c
 // Taken from http://nenolod.net/projects/upse/
 #define OVERALL_SCALE (0.87f)
 
+static FrequencyResponseFilter FRF = FrequencyResponseFilter();
+
 StereoOut32 Apply_Frequency_Response_Filter(StereoOut32 &SoundStream)
 {
-    static FrequencyResponseFilter FRF = FrequencyResponseFilter();
-
     s32 in, out;
     s32 l, r;
     s32 mid, side;
@@ -750,20 +1277,20 @@ StereoOut32 Apply_Frequency_Response_Filter(StereoOut32 &SoundStream)
     return SoundStream;
 }
 
+static StereoOut32 DealiasOld = StereoOut32();
+
 StereoOut32 Apply_Dealias_Filter(StereoOut32 &SoundStream)
 {
-    static StereoOut32 Old = StereoOut32::Empty;
-
     s32 l, r;
 
     l = SoundStream.Left;
     r = SoundStream.Right;
 
-    l += (l - Old.Left);
-    r += (r - Old.Right);
+    l += (l - DealiasOld.Left);
+    r += (r - DealiasOld.Right);
 
-    Old.Left = SoundStream.Left;
-    Old.Right = SoundStream.Right;
+    DealiasOld.Left = SoundStream.Left;
+    DealiasOld.Right = SoundStream.Right;
 
     SoundStream.Left = l;
     SoundStream.Right = r;
@@ -773,6 +1300,7 @@ StereoOut32 Apply_Dealias_Filter(StereoOut32 &SoundStream)
 
 // used to throttle the output rate of cache stat reports
 static int p_cachestat_counter = 0;
+static PcmCacheStats p_cachestat_last;
 
 // Gcc does not want to inline it when lto is enabled because some functions growth too much.
 // The function is big enought to see any speed impact. -- Gregory
@@ -799,8 +1327,25 @@ __forceinline
 
     // Todo: Replace me with memzero initializer!
     VoiceMixSet VoiceData[2] = {VoiceMixSet::Empty, VoiceMixSet::Empty}; // mixed voice data for each core.
-    MixCoreVoices(VoiceData[0], 0);
-    MixCoreVoices(VoiceData[1], 1);
+    {
+        ReplayStageTimer timer(ReplayStage_Voices);
+
+        if (Cycles % PcmPrefetchInterval == 0)
+            PrefetchPcmBlocks();
+
+        if (s_BlockPos < s_BlockLen) {
+            for (int i = 0; i < 2; i++)
+                if (s_BlockIrq[s_BlockPos] & (4 << i))
+                    SetIrqCall(i);
+
+            MixCoreLanes(VoiceData[0], s_BlockLanes[s_BlockPos][0]);
+            MixCoreLanes(VoiceData[1], s_BlockLanes[s_BlockPos][1]);
+            s_BlockPos++;
+        } else {
+            MixCoreVoices(VoiceData[0], 0);
+            MixCoreVoices(VoiceData[1], 1);
+        }
+    }
 
     StereoOut32 Ext(Cores[0].Mix(VoiceData[0], InputData[0], StereoOut32::Empty));
 
@@ -862,19 +1407,32 @@ __forceinline
     if (OutPos >= 0x200)
         OutPos = 0;
 
-    if (IsDevBuild) {
-        p_cachestat_counter++;
-        if (p_cachestat_counter > (48000 * 10)) {
-            p_cachestat_counter = 0;
-            if (MsgCache())
-                ConLog(" * SPU2 > CacheStats > Hits: %d  Misses: %d  Ignores: %d\n",
-                       g_counter_cache_hits,
-                       g_counter_cache_misses,
-                       g_counter_cache_ignores);
-
-            g_counter_cache_hits =
-                g_counter_cache_misses =
-                    g_counter_cache_ignores = 0;
-        }
+    p_cachestat_counter++;
+    if (p_cachestat_counter > (48000 * 10)) {
+        p_cachestat_counter = 0;
+        if (MsgCache())
+            ConLog(" * SPU2 > CacheStats > Hits: %llu  Misses: %llu  Prefetched: %llu  Invalidated: %llu\n",
+                   pcm_cache_stats.Hits - p_cachestat_last.Hits,
+                   pcm_cache_stats.Misses - p_cachestat_last.Misses,
+                   pcm_cache_stats.Prefetched - p_cachestat_last.Prefetched,
+                   pcm_cache_stats.Invalidated - p_cachestat_last.Invalidated);
+
+        p_cachestat_last = pcm_cache_stats;
     }
 }
+
+// Puts the state kept by the mixer itself back to power on, so that a recording replays
+// the same way every time.
+void ResetMixer()
+{
+    NoiseLfsr = 0xC0FEu;
+    FRF = FrequencyResponseFilter();
+    DealiasOld = StereoOut32();
+
+    s_BlockPos = 0;
+    s_BlockLen = 0;
+
+    pcm_cache_stats = PcmCacheStats();
+    p_cachestat_last = PcmCacheStats();
+    p_cachestat_counter = 0;
+}
@@ -130,6 +130,8 @@ struct FrequencyResponseFilter
 };
 
 extern void Mix();
+extern void PrepareVoiceBlock(uint samples);
+extern void ResetMixer();
 extern s32 clamp_mix(s32 x, u8 bitshift = 0);
 
 extern StereoOut32 clamp_mix(const StereoOut32 &sample, u8 bitshift = 0);
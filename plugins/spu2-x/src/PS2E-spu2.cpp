@@ -19,6 +19,7 @@
 #include "PS2E-spu2.h"
 #include "Dma.h"
 #include "Dialogs.h"
+#include "MixThread.h"
 
 #ifdef __APPLE__
 #include "PS2Eext.h"
@@ -192,11 +193,17 @@ void (*dma7callback)();
 EXPORT_C_(u32)
 CALLBACK SPU2ReadMemAddr(int core)
 {
+    if (MixThread::IsActive())
+        MixThread::Sync();
+
     return Cores[core].MADR;
 }
 EXPORT_C_(void)
 CALLBACK SPU2WriteMemAddr(int core, u32 value)
 {
+    if (MixThread::IsActive())
+        MixThread::Sync();
+
     Cores[core].MADR = value;
 }
 
@@ -221,14 +228,66 @@ CALLBACK SPU2setLogDir(const char *dir)
 EXPORT_C_(void)
 SPU2irqCallback(void (*SPU2callback)(), void (*DMA4callback)(), void (*DMA7callback)())
 {
+    if (MixThread::IsActive()) {
+        MixThread::SetCallbacks(SPU2callback, DMA4callback, DMA7callback);
+        return;
+    }
+
     _irqcallback = SPU2callback;
     dma4callback = DMA4callback;
     dma7callback = DMA7callback;
 }
 
+// Current IOP clock, for the commands queued to the mixing thread.
+static u32 GetClocks()
+{
+    return (cyclePtr != NULL) ? *cyclePtr : pClocks;
+}
+
+// The bodies of the write paths, shared with the mixing thread which replays them in order.
+
+void SPU2_WriteDMA(int core, u16 *pMem, u32 size)
+{
+    FileLog("[%10d] SPU2 writeDMA%dMem size %x at address %x\n", Cycles, core ? 7 : 4, size << 1, Cores[core].TSA);
+#ifdef S2R_ENABLE
+    if (!replay_mode) {
+        if (core)
+            s2r_writedma7(Cycles, pMem, size);
+        else
+            s2r_writedma4(Cycles, pMem, size);
+    }
+#endif
+    Cores[core].DoDMAwrite(pMem, size);
+}
+
+void SPU2_InterruptDMA(int core)
+{
+    FileLog("[%10d] SPU2 interruptDMA%d\n", Cycles, core ? 7 : 4);
+    Cores[core].Regs.STATX |= 0x80;
+    //Cores[core].Regs.ATTR &= ~0x30;
+}
+
+void SPU2_WriteReg(u32 rmem, u16 value)
+{
+#ifdef S2R_ENABLE
+    if (!replay_mode)
+        s2r_writereg(Cycles, rmem, value);
+#endif
+
+    if (rmem >> 16 == 0x1f80)
+        Cores[0].WriteRegPS1(rmem, value);
+    else {
+        SPU2writeLog("write", rmem, value);
+        SPU2_FastWrite(rmem, value);
+    }
+}
+
 EXPORT_C_(void)
 CALLBACK SPU2readDMA4Mem(u16 *pMem, u32 size) // size now in 16bit units
 {
+    if (MixThread::IsActive())
+        MixThread::Sync();
+
     if (cyclePtr != NULL)
         TimeUpdate(*cyclePtr);
 
@@ -239,36 +298,41 @@ CALLBACK SPU2readDMA4Mem(u16 *pMem, u32 size) // size now in 16bit units
 EXPORT_C_(void)
 CALLBACK SPU2writeDMA4Mem(u16 *pMem, u32 size) // size now in 16bit units
 {
+    if (MixThread::IsActive()) {
+        MixThread::WriteDMA(0, pMem, size, GetClocks());
+        return;
+    }
+
     if (cyclePtr != NULL)
         TimeUpdate(*cyclePtr);
 
-    FileLog("[%10d] SPU2 writeDMA4Mem size %x at address %x\n", Cycles, size << 1, Cores[0].TSA);
-#ifdef S2R_ENABLE
-    if (!replay_mode)
-        s2r_writedma4(Cycles, pMem, size);
-#endif
-    Cores[0].DoDMAwrite(pMem, size);
+    SPU2_WriteDMA(0, pMem, size);
 }
 
 EXPORT_C_(void)
 CALLBACK SPU2interruptDMA4()
 {
-    FileLog("[%10d] SPU2 interruptDMA4\n", Cycles);
-    Cores[0].Regs.STATX |= 0x80;
-    //Cores[0].Regs.ATTR &= ~0x30;
+    if (MixThread::IsActive())
+        MixThread::InterruptDMA(0);
+    else
+        SPU2_InterruptDMA(0);
 }
 
 EXPORT_C_(void)
 CALLBACK SPU2interruptDMA7()
 {
-    FileLog("[%10d] SPU2 interruptDMA7\n", Cycles);
-    Cores[1].Regs.STATX |= 0x80;
-    //Cores[1].Regs.ATTR &= ~0x30;
+    if (MixThread::IsActive())
+        MixThread::InterruptDMA(1);
+    else
+        SPU2_InterruptDMA(1);
 }
 
 EXPORT_C_(void)
 CALLBACK SPU2readDMA7Mem(u16 *pMem, u32 size)
 {
+    if (MixThread::IsActive())
+        MixThread::Sync();
+
     if (cyclePtr != NULL)
         TimeUpdate(*cyclePtr);
 
@@ -279,23 +343,27 @@ CALLBACK SPU2readDMA7Mem(u16 *pMem, u32 size)
 EXPORT_C_(void)
 CALLBACK SPU2writeDMA7Mem(u16 *pMem, u32 size)
 {
+    if (MixThread::IsActive()) {
+        MixThread::WriteDMA(1, pMem, size, GetClocks());
+        return;
+    }
+
     if (cyclePtr != NULL)
         TimeUpdate(*cyclePtr);
 
-    FileLog("[%10d] SPU2 writeDMA7Mem size %x at address %x\n", Cycles, size << 1, Cores[1].TSA);
-#ifdef S2R_ENABLE
-    if (!replay_mode)
-        s2r_writedma7(Cycles, pMem, size);
-#endif
-    Cores[1].DoDMAwrite(pMem, size);
+    SPU2_WriteDMA(1, pMem, size);
 }
 
 EXPORT_C_(void)
 SPU2reset()
 {
+    if (MixThread::IsActive())
+        MixThread::Sync();
+
     memset(spu2regs, 0, 0x010000);
     memset(_spu2mem, 0, 0x200000);
     memset(_spu2mem + 0x2800, 7, 0x10); // from BIOS reversal. Locks the voices so they don't run free.
+    InvalidatePcmCache(0, 0x100000);
     Cores[0].Init(0);
     Cores[1].Init(1);
 }
@@ -439,6 +507,10 @@ SPU2open(void *pDsp)
         DspLoadLibrary(dspPlugin, dspPluginModule);
 #endif
         WaveDump::Open();
+
+        // The replayers drive the plugin call by call and expect the state to follow.
+        if (ThreadedMixing && !replay_mode)
+            MixThread::Open();
     } catch (std::exception &ex) {
         fprintf(stderr, "SPU2-X Error: Could not initialize device, or something.\nReason: %s", ex.what());
         SPU2close();
@@ -454,6 +526,8 @@ SPU2close()
         return;
     IsOpened = false;
 
+    MixThread::Close();
+
     FileLog("[%10d] SPU2 Close\n", Cycles);
 
 #ifndef __POSIX__
@@ -522,12 +596,13 @@ SPU2async(u32 cycles)
 {
     DspUpdate();
 
-    if (cyclePtr != NULL) {
-        TimeUpdate(*cyclePtr);
-    } else {
+    if (cyclePtr == NULL)
         pClocks += cycles;
-        TimeUpdate(pClocks);
-    }
+
+    if (MixThread::IsActive())
+        MixThread::Async(GetClocks());
+    else
+        TimeUpdate(GetClocks());
 
 #ifdef DEBUG_KEYS
     u32 curTicks = GetTickCount();
@@ -583,6 +658,11 @@ SPU2read(u32 rmem)
     //	if(!replay_mode)
     //		s2r_readreg(Cycles,rmem);
 
+    // Everything read back may depend on how far the mixer got (ENDX, ENVX, IRQ and DMA
+    // status...), so catch up first.
+    if (MixThread::IsActive())
+        MixThread::Sync();
+
     u16 ret = 0xDEAD;
     u32 core = 0, mem = rmem & 0xFFFF, omem = mem;
     if (mem & 0x400) {
@@ -614,24 +694,19 @@ SPU2read(u32 rmem)
 EXPORT_C_(void)
 SPU2write(u32 rmem, u16 value)
 {
-#ifdef S2R_ENABLE
-    if (!replay_mode)
-        s2r_writereg(Cycles, rmem, value);
-#endif
-
     // Note: Reverb/Effects are very sensitive to having precise update timings.
     // If the SPU2 isn't in in sync with the IOP, samples can end up playing at rather
     // incorrect pitches and loop lengths.
 
+    if (MixThread::IsActive()) {
+        MixThread::Write(rmem, value, GetClocks());
+        return;
+    }
+
     if (cyclePtr != NULL)
         TimeUpdate(*cyclePtr);
 
-    if (rmem >> 16 == 0x1f80)
-        Cores[0].WriteRegPS1(rmem, value);
-    else {
-        SPU2writeLog("write", rmem, value);
-        SPU2_FastWrite(rmem, value);
-    }
+    SPU2_WriteReg(rmem, value);
 }
 
 // if start is 1, starts recording spu2 data, else stops
@@ -640,6 +715,9 @@ SPU2write(u32 rmem, u16 value)
 EXPORT_C_(int)
 SPU2setupRecording(int start, void *pData)
 {
+    if (MixThread::IsActive())
+        MixThread::Sync();
+
     if (start == 0)
         RecordStop();
     else if (start == 1)
@@ -664,6 +742,9 @@ SPU2freeze(int mode, freezeData *data)
 
     pxAssume(mode == FREEZE_LOAD || mode == FREEZE_SAVE);
 
+    if (MixThread::IsActive())
+        MixThread::Sync();
+
     if (data->data == NULL) {
         printf("SPU2-X savestate null pointer!\n");
         return -1;
@@ -48,9 +48,9 @@ SPU2write(u32 mem, u16 value);
 EXPORT_C_(u16)
 SPU2read(u32 mem);
 
-// These defines are useless and gcc-4.6 complain about redefinition
-// so we remove them on linux
-#ifndef __POSIX__
+// PS2Edefs.h already declares these (with an int size) for the builtin plugin, and gcc
+// complains about the redefinition.  The replay code needs them everywhere else.
+#ifndef BUILTIN_SPU2_PLUGIN
 EXPORT_C_(void)
 SPU2readDMA4Mem(u16 *pMem, u32 size);
 EXPORT_C_(void)
@@ -116,6 +116,9 @@ extern u32 *cyclePtr;
 extern void SPU2writeLog(const char *action, u32 rmem, u16 value);
 extern void TimeUpdate(u32 cClocks);
 extern void SPU2_FastWrite(u32 rmem, u16 value);
+extern void SPU2_WriteReg(u32 rmem, u16 value);
+extern void SPU2_WriteDMA(int core, u16 *pMem, u32 size);
+extern void SPU2_InterruptDMA(int core);
 
 extern void LowPassFilterInit();
 
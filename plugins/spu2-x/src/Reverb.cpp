@@ -17,6 +17,10 @@
 
 #include "Global.h"
 
+#if defined(__SSE4_1__) || defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
 __forceinline s32 V_Core::RevbGetIndexer(s32 offset)
 {
     u32 pos = ReverbX + offset;
@@ -55,6 +59,100 @@ StereoOut32 V_Core::DoReverb(const StereoOut32 &Input)
 
     bool R = Cycles & 1;
 
+#if defined(__SSE4_1__) || defined(__AVX2__)
+
+    // Calculate all the read/write addresses at once, like RevbGetIndexer. RevBuffers holds
+    // them as L/R pairs (DIFF_x_SRC are stored the other way around to match), so the left
+    // side uses the even ones and the right side the odd ones.
+
+    static const int AddressCount = offsetof(V_ReverbBuffers, APF2_R_SRC) / sizeof(s32) + 1;
+    static_assert(AddressCount == 28, "RevBuffers addresses must be contiguous");
+    static_assert(offsetof(V_ReverbBuffers, DIFF_R_SRC) + sizeof(s32) == offsetof(V_ReverbBuffers, DIFF_L_SRC), "RevBuffers addresses must be L/R pairs");
+
+    alignas(16) u32 addr[AddressCount];
+    u32 irqhits[2] = {0, 0};
+
+    const __m128i x = _mm_set1_epi32(ReverbX);
+    const __m128i end = _mm_set1_epi32(EffectsEndA);
+    const __m128i wrap = _mm_set1_epi32(EffectsEndA + 1 - EffectsStartA);
+    const __m128i irqa0 = _mm_set1_epi32(Cores[0].IRQA);
+    const __m128i irqa1 = _mm_set1_epi32(Cores[1].IRQA);
+
+    for (int i = 0; i < AddressCount; i += 4) {
+        __m128i pos = _mm_add_epi32(x, _mm_loadu_si128((const __m128i *)((const s32 *)&RevBuffers + i)));
+        pos = _mm_sub_epi32(pos, _mm_and_si128(_mm_cmpgt_epi32(pos, end), wrap));
+        _mm_store_si128((__m128i *)&addr[i], pos);
+
+        irqhits[0] |= _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(pos, irqa0))) << i;
+        irqhits[1] |= _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(pos, irqa1))) << i;
+    }
+
+#define RevbAddr(name) addr[offsetof(V_ReverbBuffers, name) / sizeof(s32) + R]
+
+    const u32 same_src = RevbAddr(SAME_L_SRC);
+    const u32 same_dst = RevbAddr(SAME_L_DST);
+    const u32 same_prv = RevbAddr(SAME_L_PRV);
+
+    const u32 diff_src = RevbAddr(DIFF_R_SRC);
+    const u32 diff_dst = RevbAddr(DIFF_L_DST);
+    const u32 diff_prv = RevbAddr(DIFF_L_PRV);
+
+    const u32 comb1_src = RevbAddr(COMB1_L_SRC);
+    const u32 comb2_src = RevbAddr(COMB2_L_SRC);
+    const u32 comb3_src = RevbAddr(COMB3_L_SRC);
+    const u32 comb4_src = RevbAddr(COMB4_L_SRC);
+
+    const u32 apf1_src = RevbAddr(APF1_L_SRC);
+    const u32 apf1_dst = RevbAddr(APF1_L_DST);
+    const u32 apf2_src = RevbAddr(APF2_L_SRC);
+    const u32 apf2_dst = RevbAddr(APF2_L_DST);
+
+#undef RevbAddr
+
+    // IRQ test, with the same effects area shortcut as below.
+
+    const u32 side = R ? 0xAAAAAAAA : 0x55555555;
+
+    for (int i = 0; i < 2; i++) {
+        if (Cores[i].IRQEnable && ((Cores[i].IRQA >= EffectsStartA) && (Cores[i].IRQA <= EffectsEndA))) {
+            if (irqhits[i] & side)
+                SetIrqCall(i);
+        }
+    }
+
+    // Same network as the scalar code below, same and diff side by side and the four comb
+    // filter taps in one vector.
+
+    s32 in, same, diff, apf1, apf2, out;
+
+#define MUL(x, y) ((x) * (y) >> 15)
+    in = MUL(R ? Revb.IN_COEF_R : Revb.IN_COEF_L, R ? Input.Right : Input.Left);
+
+    const __m128i iir_src = _mm_setr_epi32(_spu2mem[same_src], _spu2mem[diff_src], 0, 0);
+    const __m128i iir_prv = _mm_setr_epi32(_spu2mem[same_prv], _spu2mem[diff_prv], 0, 0);
+
+    __m128i iir = _mm_srai_epi32(_mm_mullo_epi32(_mm_set1_epi32(Revb.WALL_VOL), iir_src), 15);
+    iir = _mm_sub_epi32(_mm_add_epi32(_mm_set1_epi32(in), iir), iir_prv);
+    iir = _mm_add_epi32(_mm_srai_epi32(_mm_mullo_epi32(_mm_set1_epi32(Revb.IIR_VOL), iir), 15), iir_prv);
+
+    same = _mm_cvtsi128_si32(iir);
+    diff = _mm_extract_epi32(iir, 1);
+
+    const __m128i comb_vol = _mm_setr_epi32(Revb.COMB1_VOL, Revb.COMB2_VOL, Revb.COMB3_VOL, Revb.COMB4_VOL);
+    const __m128i comb_src = _mm_setr_epi32(_spu2mem[comb1_src], _spu2mem[comb2_src], _spu2mem[comb3_src], _spu2mem[comb4_src]);
+
+    __m128i comb = _mm_srai_epi32(_mm_mullo_epi32(comb_vol, comb_src), 15);
+    comb = _mm_add_epi32(comb, _mm_shuffle_epi32(comb, _MM_SHUFFLE(1, 0, 3, 2)));
+    comb = _mm_add_epi32(comb, _mm_shuffle_epi32(comb, _MM_SHUFFLE(2, 3, 0, 1)));
+    out = _mm_cvtsi128_si32(comb);
+
+    apf1 = out - MUL(Revb.APF1_VOL, _spu2mem[apf1_src]);
+    out = _spu2mem[apf1_src] + MUL(Revb.APF1_VOL, apf1);
+    apf2 = out - MUL(Revb.APF2_VOL, _spu2mem[apf2_src]);
+    out = _spu2mem[apf2_src] + MUL(Revb.APF2_VOL, apf2);
+
+#else
+
     // Calculate the read/write addresses we'll be needing for this session of reverb.
 
     const u32 same_src = RevbGetIndexer(R ? RevBuffers.SAME_R_SRC : RevBuffers.SAME_L_SRC);
@@ -119,8 +217,15 @@ StereoOut32 V_Core::DoReverb(const StereoOut32 &Input)
     apf2 = out - MUL(Revb.APF2_VOL, _spu2mem[apf2_src]);
     out = _spu2mem[apf2_src] + MUL(Revb.APF2_VOL, apf2);
 
+#endif
+
     // According to no$psx the effects always run but don't always write back, see check in V_Core::Mix
     if (FxEnable) {
+        InvalidatePcmCache(same_dst);
+        InvalidatePcmCache(diff_dst);
+        InvalidatePcmCache(apf1_dst);
+        InvalidatePcmCache(apf2_dst);
+
         _spu2mem[same_dst] = clamp_mix(same);
         _spu2mem[diff_dst] = clamp_mix(diff);
         _spu2mem[apf1_dst] = clamp_mix(apf1);
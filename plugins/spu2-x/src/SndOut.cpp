@@ -16,6 +16,7 @@
  */
 
 #include "Global.h"
+#include "Spu2replay.h"
 
 
 StereoOut32 StereoOut32::Empty(0, 0);
@@ -27,8 +28,8 @@ StereoOut32::StereoOut32(const StereoOut16 &src)
 }
 
 StereoOut32::StereoOut32(const StereoOutFloat &src)
-    : Left((s32)(src.Left * 2147483647.0f))
-    , Right((s32)(src.Right * 2147483647.0f))
+    : Left((s32)(src.Left * SndOutFloatScale))
+    , Right((s32)(src.Right * SndOutFloatScale))
 {
 }
 
@@ -111,14 +112,15 @@ int FindOutputModuleById(const wchar_t *omodid)
     return modcnt;
 }
 
-StereoOut32 *SndBuffer::m_buffer;
+StereoOutFloat *SndBuffer::m_buffer;
 s32 SndBuffer::m_size;
-__aligned(4) volatile s32 SndBuffer::m_rpos;
-__aligned(4) volatile s32 SndBuffer::m_wpos;
+__aligned(64) std::atomic<s32> SndBuffer::m_rpos;
+__aligned(64) std::atomic<s32> SndBuffer::m_wpos;
 
 bool SndBuffer::m_underrun_freeze;
 StereoOut32 *SndBuffer::sndTempBuffer = NULL;
 StereoOut16 *SndBuffer::sndTempBuffer16 = NULL;
+StereoOutFloat *SndBuffer::sndTempBufferFloat = NULL;
 int SndBuffer::sndTempProgress = 0;
 
 int GetAlignedBufferSize(int comp)
@@ -173,36 +175,39 @@ void SndBuffer::_InitFail()
 int SndBuffer::_GetApproximateDataInBuffer()
 {
     // WARNING: not necessarily 100% up to date by the time it's used, but it will have to do.
-    return (m_wpos + m_size - m_rpos) % m_size;
+    // The acquires make the samples counted here visible to whichever side is asking.
+    return (m_wpos.load(std::memory_order_acquire) + m_size - m_rpos.load(std::memory_order_acquire)) % m_size;
 }
 
-void SndBuffer::_WriteSamples_Internal(StereoOut32 *bData, int nSamples)
+void SndBuffer::_WriteSamples_Internal(const StereoOutFloat *bData, int nSamples)
 {
     // WARNING: This assumes the write will NOT wrap around,
     // and also assumes there's enough free space in the buffer.
 
-    memcpy(m_buffer + m_wpos, bData, nSamples * sizeof(StereoOut32));
-    m_wpos = (m_wpos + nSamples) % m_size;
+    const s32 wpos = m_wpos.load(std::memory_order_relaxed);
+    memcpy(m_buffer + wpos, bData, nSamples * sizeof(StereoOutFloat));
+    m_wpos.store((wpos + nSamples) % m_size, std::memory_order_release);
 }
 
 void SndBuffer::_DropSamples_Internal(int nSamples)
 {
-    m_rpos = (m_rpos + nSamples) % m_size;
+    m_rpos.store((m_rpos.load(std::memory_order_relaxed) + nSamples) % m_size, std::memory_order_release);
 }
 
-void SndBuffer::_ReadSamples_Internal(StereoOut32 *bData, int nSamples)
+void SndBuffer::_ReadSamples_Internal(StereoOutFloat *bData, int nSamples)
 {
     // WARNING: This assumes the read will NOT wrap around,
     // and also assumes there's enough data in the buffer.
-    memcpy(bData, m_buffer + m_rpos, nSamples * sizeof(StereoOut32));
+    memcpy(bData, m_buffer + m_rpos.load(std::memory_order_relaxed), nSamples * sizeof(StereoOutFloat));
     _DropSamples_Internal(nSamples);
 }
 
-void SndBuffer::_WriteSamples_Safe(StereoOut32 *bData, int nSamples)
+void SndBuffer::_WriteSamples_Safe(const StereoOutFloat *bData, int nSamples)
 {
     // WARNING: This code assumes there's only ONE writing process.
-    if ((m_size - m_wpos) < nSamples) {
-        int b1 = m_size - m_wpos;
+    const s32 wpos = m_wpos.load(std::memory_order_relaxed);
+    if ((m_size - wpos) < nSamples) {
+        int b1 = m_size - wpos;
         int b2 = nSamples - b1;
 
         _WriteSamples_Internal(bData, b1);
@@ -212,11 +217,12 @@ void SndBuffer::_WriteSamples_Safe(StereoOut32 *bData, int nSamples)
     }
 }
 
-void SndBuffer::_ReadSamples_Safe(StereoOut32 *bData, int nSamples)
+void SndBuffer::_ReadSamples_Safe(StereoOutFloat *bData, int nSamples)
 {
     // WARNING: This code assumes there's only ONE reading process.
-    if ((m_size - m_rpos) < nSamples) {
-        int b1 = m_size - m_rpos;
+    const s32 rpos = m_rpos.load(std::memory_order_relaxed);
+    if ((m_size - rpos) < nSamples) {
+        int b1 = m_size - rpos;
         int b2 = nSamples - b1;
 
         _ReadSamples_Internal(bData, b1);
@@ -226,6 +232,30 @@ void SndBuffer::_ReadSamples_Safe(StereoOut32 *bData, int nSamples)
     }
 }
 
+// The buffer holds float samples: fixed point outputs convert them through StereoOut32,
+// float outputs take them as they are.
+template <typename T>
+static __forceinline void ResampleFrom(T &dest, const StereoOutFloat &src)
+{
+    dest.ResampleFrom(StereoOut32(src));
+}
+
+template <typename T>
+static __forceinline void AdjustFrom(T &dest, const StereoOutFloat &src)
+{
+    dest.AdjustFrom(StereoOut32(src));
+}
+
+static __forceinline void ResampleFrom(StereoOutFloat &dest, const StereoOutFloat &src)
+{
+    dest = src;
+}
+
+static __forceinline void AdjustFrom(StereoOutFloat &dest, const StereoOutFloat &src)
+{
+    dest = StereoOutFloat(src.Left * VolumeAdjustFL, src.Right * VolumeAdjustFR);
+}
+
 // Note: When using with 32 bit output buffers, the user of this function is responsible
 // for shifting the values to where they need to be manually.  The fixed point depth of
 // the sample output is determined by the SndOutVolumeShift, which is the number of bits
@@ -253,7 +283,8 @@ void SndBuffer::ReadSamples(T *bData)
         pxAssume(nSamples <= SndOutPacketSize);
 
         // WARNING: This code assumes there's only ONE reading process.
-        int b1 = m_size - m_rpos;
+        const s32 rpos = m_rpos.load(std::memory_order_relaxed);
+        int b1 = m_size - rpos;
 
         if (b1 > nSamples)
             b1 = nSamples;
@@ -261,21 +292,21 @@ void SndBuffer::ReadSamples(T *bData)
         if (AdvancedVolumeControl) {
             // First part
             for (int i = 0; i < b1; i++)
-                bData[i].AdjustFrom(m_buffer[i + m_rpos]);
+                AdjustFrom(bData[i], m_buffer[i + rpos]);
 
             // Second part
             int b2 = nSamples - b1;
             for (int i = 0; i < b2; i++)
-                bData[i + b1].AdjustFrom(m_buffer[i]);
+                AdjustFrom(bData[i + b1], m_buffer[i]);
         } else {
             // First part
             for (int i = 0; i < b1; i++)
-                bData[i].ResampleFrom(m_buffer[i + m_rpos]);
+                ResampleFrom(bData[i], m_buffer[i + rpos]);
 
             // Second part
             int b2 = nSamples - b1;
             for (int i = 0; i < b2; i++)
-                bData[i + b1].ResampleFrom(m_buffer[i]);
+                ResampleFrom(bData[i + b1], m_buffer[i]);
         }
 
         _DropSamples_Internal(nSamples);
@@ -289,8 +320,8 @@ void SndBuffer::ReadSamples(T *bData)
 
 template void SndBuffer::ReadSamples(StereoOut16 *);
 template void SndBuffer::ReadSamples(StereoOut32 *);
+template void SndBuffer::ReadSamples(StereoOutFloat *);
 
-//template void SndBuffer::ReadSamples(StereoOutFloat*);
 template void SndBuffer::ReadSamples(Stereo21Out16 *);
 template void SndBuffer::ReadSamples(Stereo40Out16 *);
 template void SndBuffer::ReadSamples(Stereo41Out16 *);
@@ -308,7 +339,7 @@ template void SndBuffer::ReadSamples(Stereo51Out32Dpl *);
 template void SndBuffer::ReadSamples(Stereo51Out32DplII *);
 template void SndBuffer::ReadSamples(Stereo71Out32 *);
 
-void SndBuffer::_WriteSamples(StereoOut32 *bData, int nSamples)
+void SndBuffer::_WriteSamples(const StereoOutFloat *bData, int nSamples)
 {
     m_predictData = 0;
 
@@ -371,17 +402,18 @@ void SndBuffer::Init()
     // Buffer actually attempts to run ~50%, so allocate near double what
     // the requested latency is:
 
-    m_rpos = 0;
-    m_wpos = 0;
+    m_rpos.store(0);
+    m_wpos.store(0);
 
     try {
         const float latencyMS = SndOutLatencyMS * 16;
         m_size = GetAlignedBufferSize((int)(latencyMS * SampleRate / 1000.0f));
-        m_buffer = new StereoOut32[m_size];
+        m_buffer = new StereoOutFloat[m_size];
         m_underrun_freeze = false;
 
         sndTempBuffer = new StereoOut32[SndOutPacketSize];
         sndTempBuffer16 = new StereoOut16[SndOutPacketSize * 2]; // in case of leftovers.
+        sndTempBufferFloat = new StereoOutFloat[SndOutPacketSize];
     } catch (std::bad_alloc &) {
         // out of memory exception (most likely)
 
@@ -408,6 +440,7 @@ void SndBuffer::Cleanup()
     safe_delete_array(m_buffer);
     safe_delete_array(sndTempBuffer);
     safe_delete_array(sndTempBuffer16);
+    safe_delete_array(sndTempBufferFloat);
 }
 
 int SndBuffer::m_dsp_progress = 0;
@@ -421,6 +454,19 @@ void SndBuffer::ClearContents()
     SndBuffer::ssFreeze = 256; //Delays sound output for about 1 second.
 }
 
+void SndBuffer::_WritePacket()
+{
+    // The packet's only int to float pass: the timestretcher, the buffer and float outputs
+    // all work on floats from here on.
+    for (int i = 0; i < SndOutPacketSize; ++i)
+        sndTempBufferFloat[i] = StereoOutFloat(sndTempBuffer[i]);
+
+    if (SynchMode == 0) // TimeStrech on
+        timeStretchWrite();
+    else
+        _WriteSamples(sndTempBufferFloat, SndOutPacketSize);
+}
+
 void SndBuffer::Write(const StereoOut32 &Sample)
 {
     // Log final output to wavefile.
@@ -429,9 +475,14 @@ void SndBuffer::Write(const StereoOut32 &Sample)
     if (WavRecordEnabled)
         RecordWrite(Sample.DownSample());
 
-    if (mods[OutputModule] == &NullOut) // null output doesn't need buffering or stretching! :p
+    if (replay_mode)
+        s2r_hashsample(Sample);
+
+    if (mods[OutputModule] == &NullOut && !replay_timestretch) // null output doesn't need buffering or stretching! :p
         return;
 
+    ReplayStageTimer timer(ReplayStage_TimeStretch);
+
     sndTempBuffer[sndTempProgress++] = Sample;
 
     // If we haven't accumulated a full packet yet, do nothing more:
@@ -462,10 +513,7 @@ void SndBuffer::Write(const StereoOut32 &Sample)
                 sndTempBuffer[i] = sndTempBuffer16[ei].UpSample();
             }
 
-            if (SynchMode == 0) // TimeStrech on
-                timeStretchWrite();
-            else
-                _WriteSamples(sndTempBuffer, SndOutPacketSize);
+            _WritePacket();
 
             m_dsp_progress -= SndOutPacketSize;
         }
@@ -478,10 +526,15 @@ void SndBuffer::Write(const StereoOut32 &Sample)
     }
 #endif
     else {
-        if (SynchMode == 0) // TimeStrech on
-            timeStretchWrite();
-        else
-            _WriteSamples(sndTempBuffer, SndOutPacketSize);
+        _WritePacket();
+    }
+
+    // Nothing reads from the null output, so play the device ourselves: keep the buffer at
+    // the fill level the timestretcher aims for.
+    if (mods[OutputModule] == &NullOut) {
+        StereoOutFloat discard[SndOutPacketSize];
+        while (_GetApproximateDataInBuffer() > m_size / 2)
+            ReadSamples(discard);
     }
 }
 
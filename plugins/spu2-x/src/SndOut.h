@@ -29,6 +29,9 @@ static const int SndOutPacketSize = 64;
 static const int SndOutVolumeShift = 12;
 static const int SndOutVolumeShift32 = 16 - SndOutVolumeShift; // shift up, not down
 
+// Float samples are normalized: 1.0 is a full scale 16 bit sample shifted up by SndOutVolumeShift.
+static const float SndOutFloatScale = (float)(1 << (SndOutVolumeShift + 15));
+
 // Samplerate of the SPU2. For accurate playback we need to match this
 // exactly.  Trying to scale samplerates and maintain SPU2's Ts timing accuracy
 // is too problematic. :)
@@ -111,14 +114,14 @@ struct StereoOutFloat
     }
 
     explicit StereoOutFloat(const StereoOut32 &src)
-        : Left(src.Left / 2147483647.0f)
-        , Right(src.Right / 2147483647.0f)
+        : Left(src.Left / SndOutFloatScale)
+        , Right(src.Right / SndOutFloatScale)
     {
     }
 
     explicit StereoOutFloat(s32 left, s32 right)
-        : Left(left / 2147483647.0f)
-        , Right(right / 2147483647.0f)
+        : Left(left / SndOutFloatScale)
+        , Right(right / SndOutFloatScale)
     {
     }
 
@@ -571,6 +574,7 @@ private:
 
     static StereoOut32 *sndTempBuffer;
     static StereoOut16 *sndTempBuffer16;
+    static StereoOutFloat *sndTempBufferFloat;
 
     static int sndTempProgress;
     static int m_dsp_progress;
@@ -578,11 +582,14 @@ private:
     static int m_timestretch_progress;
     static int m_timestretch_writepos;
 
-    static StereoOut32 *m_buffer;
+    // Lock-free ring between the mixer (the only writer) and the output driver (the only
+    // reader).  Each side only stores its own index, and the two live on separate cache
+    // lines so the threads don't keep stealing the same line from each other.
+    static StereoOutFloat *m_buffer;
     static s32 m_size;
 
-    static __aligned(4) volatile s32 m_rpos;
-    static __aligned(4) volatile s32 m_wpos;
+    static __aligned(64) std::atomic<s32> m_rpos;
+    static __aligned(64) std::atomic<s32> m_wpos;
 
     static float lastEmergencyAdj;
     static float cTempo;
@@ -604,14 +611,15 @@ private:
     static void UpdateTempoChangeSoundTouch();
     static void UpdateTempoChangeSoundTouch2();
 
-    static void _WriteSamples(StereoOut32 *bData, int nSamples);
+    static void _WritePacket();
+    static void _WriteSamples(const StereoOutFloat *bData, int nSamples);
 
-    static void _WriteSamples_Safe(StereoOut32 *bData, int nSamples);
-    static void _ReadSamples_Safe(StereoOut32 *bData, int nSamples);
+    static void _WriteSamples_Safe(const StereoOutFloat *bData, int nSamples);
+    static void _ReadSamples_Safe(StereoOutFloat *bData, int nSamples);
 
-    static void _WriteSamples_Internal(StereoOut32 *bData, int nSamples);
+    static void _WriteSamples_Internal(const StereoOutFloat *bData, int nSamples);
     static void _DropSamples_Internal(int nSamples);
-    static void _ReadSamples_Internal(StereoOut32 *bData, int nSamples);
+    static void _ReadSamples_Internal(StereoOutFloat *bData, int nSamples);
 
     static int _GetApproximateDataInBuffer();
 
@@ -626,7 +634,8 @@ public:
     // Note: When using with 32 bit output buffers, the user of this function is responsible
     // for shifting the values to where they need to be manually.  The fixed point depth of
     // the sample output is determined by the SndOutVolumeShift, which is the number of bits
-    // to shift right to get a 16 bit result.
+    // to shift right to get a 16 bit result.  StereoOutFloat outputs get the buffered samples
+    // as they are, without a trip through fixed point.
     template <typename T>
     static void ReadSamples(T *bData);
 };
@@ -200,7 +200,7 @@ public:
             switch (actualUsedChannels) {
                 case 2:
                     ConLog("* SPU2 > Using normal 2 speaker stereo output.\n");
-                    ActualPaCallback = new ConvertedSampleReader<Stereo20Out32>(&writtenSoFar);
+                    ActualPaCallback = new ConvertedSampleReader<StereoOutFloat>(&writtenSoFar);
                     break;
 
                 case 3:
@@ -266,7 +266,7 @@ public:
                 //	void *hostApiSpecificStreamInfo;
                 deviceIndex,
                 actualUsedChannels,
-                paInt32,
+                (actualUsedChannels == 2) ? paFloat32 : paInt32, // stereo takes the float samples as they are
                 m_SuggestedLatencyMinimal ? (SndOutPacketSize / (float)SampleRate) : (m_SuggestedLatencyMS / 1000.0f),
                 infoPtr};
 
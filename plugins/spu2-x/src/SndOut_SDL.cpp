@@ -27,7 +27,11 @@
  * build wx without sdl support, though) and onepad at the time of writing this. */
 #include <SDL.h>
 #include <SDL_audio.h>
+#if SDL_MAJOR_VERSION >= 2
+typedef StereoOutFloat StereoOut_SDL;
+#else
 typedef StereoOut16 StereoOut_SDL;
+#endif
 
 namespace
 {
@@ -38,10 +42,28 @@ const Uint8 channels = 2;
 /* Samples should vary from [512,8192] according to SDL spec. Take note this is the desired
 	 * sample count and SDL may provide otherwise. Pulseaudio will cut this value in half if
 	 * PA_STREAM_ADJUST_LATENCY is set in the backened, for example. */
-const Uint16 desiredSamples = 2048;
+const Uint16 maxSamples = 2048;
+const Uint16 minSamples = 256;
+#if SDL_MAJOR_VERSION >= 2
+const Uint16 format = AUDIO_F32SYS;
+#else
 const Uint16 format = AUDIO_S16SYS;
+#endif
 
-Uint16 samples = desiredSamples;
+Uint16 samples = maxSamples;
+
+/* Ask for a device period of about half the configured latency instead of always 2048
+	 * samples (43ms), so that low latency settings actually get low latency. Powers of two
+	 * keep it a multiple of the packet size. */
+Uint16 GetDesiredSamples()
+{
+    const int wanted = SndOutLatencyMS * SampleRate / 1000 / 2;
+
+    Uint16 desired = minSamples;
+    while (desired < maxSamples && desired * 2 <= wanted)
+        desired *= 2;
+    return desired;
+}
 
 std::unique_ptr<StereoOut_SDL[]> buffer;
 
@@ -80,6 +102,7 @@ struct SDLAudioMod : public SndOutModule
 
         /* SDL backends will mangle the AudioSpec and change the sample count. If we reopen
 		 * the audio backend, we need to make sure we keep our desired samples in the spec */
+        const Uint16 desiredSamples = GetDesiredSamples();
         spec.samples = desiredSamples;
 
         // Mandatory otherwise, init will be redone in SDL_OpenAudio
@@ -112,13 +135,13 @@ struct SDLAudioMod : public SndOutModule
         /* This is so ugly. It is hilariously ugly. I didn't use a vector to save reallocs. */
         if (samples != spec.samples || buffer == NULL)
             buffer = std::unique_ptr<StereoOut_SDL[]>(new StereoOut_SDL[spec.samples]);
-        if (samples != spec.samples) {
-            fprintf(stderr, "SPU2-X: SDL failed to get desired samples (%d) got %d samples instead\n", samples, spec.samples);
+        if (desiredSamples != spec.samples) {
+            fprintf(stderr, "SPU2-X: SDL failed to get desired samples (%d) got %d samples instead\n", desiredSamples, spec.samples);
 
             // Samples must always be a multiple of packet size.
             assert(spec.samples % SndOutPacketSize == 0);
-            samples = spec.samples;
         }
+        samples = spec.samples;
         SDL_PauseAudio(0);
         return 0;
     }
@@ -177,7 +200,7 @@ private:
     SDLAudioMod()
         : m_api("pulseaudio")
         , spec({SampleRate, format, channels, 0,
-                desiredSamples, 0, 0, &callback_fillBuffer, nullptr})
+                maxSamples, 0, 0, &callback_fillBuffer, nullptr})
     {
         // Number of samples must be a multiple of packet size.
         assert(samples % SndOutPacketSize == 0);
@@ -101,6 +101,21 @@ void s2r_close()
 
 bool replay_mode = false;
 
+u64 replay_hash = 0;
+u64 replay_samples = 0;
+
+bool replay_profile = false;
+bool replay_timestretch = false;
+std::chrono::steady_clock::duration replay_stage_time[ReplayStage_Count];
+
+void s2r_hashsample(const StereoOut32 &sample)
+{
+    // FNV-1a
+    replay_hash = (replay_hash ^ (u32)sample.Left) * 0x100000001B3ull;
+    replay_hash = (replay_hash ^ (u32)sample.Right) * 0x100000001B3ull;
+    replay_samples++;
+}
+
 u16 dmabuffer[0xFFFFF];
 
 const u32 IOP_CLK = 768 * 48000;
@@ -113,8 +128,6 @@ double HighResScale;
 
 bool Running = false;
 
-#ifdef _MSC_VER
-
 int conprintf(const char *fmt, ...)
 {
 #ifdef _WIN32
@@ -137,7 +150,7 @@ int conprintf(const char *fmt, ...)
 #else
     va_list list;
     va_start(list, fmt);
-    int ret = vsprintf(stderr, fmt, list);
+    int ret = vfprintf(stderr, fmt, list);
     va_end(list);
     return ret;
 #endif
@@ -157,6 +170,168 @@ void dummy7()
     SPU2interruptDMA7();
 }
 
+extern bool has_to_call_irq;
+
+struct ReplayStats
+{
+    u64 hash;
+    u64 samples;
+    int events;
+    double seconds;
+    double stage[ReplayStage_Count];
+    PcmCacheStats cache;
+};
+
+// Replays a file as fast as possible, with every event on the exact cycle it was recorded
+// at, so that the result does not depend on timing.
+static bool s2r_replay_exact(const char *filename, bool block_mixing, bool timestretch, ReplayStats &stats)
+{
+    FILE *file = fopen(filename, "rb");
+
+    if (!file) {
+        conprintf("Could not open the replay file.\n");
+        return false;
+    }
+
+    u32 ccycle = 0;
+    bool ok = fread(&ccycle, 4, 1, file) == 1;
+
+    replay_mode = true;
+    replay_hash = 0xCBF29CE484222325ull;
+    replay_samples = 0;
+    replay_profile = true;
+    replay_timestretch = timestretch;
+    for (auto &time : replay_stage_time)
+        time = std::chrono::steady_clock::duration::zero();
+
+    SPU2init();
+
+    // Same starting point for every run, whatever ran before.
+    ResetMixer();
+    Cycles = 0;
+    OutPos = 0;
+    InputPos = 0;
+    PlayMode = 0;
+    memset(&Spdif, 0, sizeof(Spdif));
+    has_to_call_irq = false;
+
+    BlockMixing = block_mixing;
+    OutputModule = 0; // null output
+    SynchMode = 0;    // fixed TickInterval
+
+    CurrentIOPCycle = 0;
+
+    SPU2irqCallback(dummy1, dummy4, dummy7);
+    SPU2setClockPtr(&CurrentIOPCycle);
+    SPU2open(NULL);
+
+    stats.events = 0;
+    const auto start = std::chrono::steady_clock::now();
+
+    while (ok) {
+        u32 sval = 0;
+        u32 tval = 0;
+
+        if (fread(&ccycle, 4, 1, file) < 1 || fread(&sval, 4, 1, file) < 1)
+            break;
+
+        u32 evid = sval >> 29;
+        sval &= 0x1FFFFFFF;
+
+        u32 TargetCycle = ccycle * 768;
+
+        // Small steps, TimeUpdate drops anything past its sanity interval.
+        while (TargetCycle > CurrentIOPCycle) {
+            u32 delta = std::min(TargetCycle - CurrentIOPCycle, IOPCiclesPerMS);
+            CurrentIOPCycle += delta;
+            SPU2async(delta);
+        }
+
+        switch (evid) {
+            case 0:
+                SPU2read(sval);
+                break;
+            case 1:
+                ok = fread(&tval, 2, 1, file) == 1;
+                if (ok)
+                    SPU2write(sval, tval);
+                break;
+            case 2:
+                ok = fread(dmabuffer, 2, sval, file) == sval;
+                if (ok)
+                    SPU2writeDMA4Mem(dmabuffer, sval);
+                break;
+            case 3:
+                ok = fread(dmabuffer, 2, sval, file) == sval;
+                if (ok)
+                    SPU2writeDMA7Mem(dmabuffer, sval);
+                break;
+            default:
+                // not implemented
+                ok = false;
+                break;
+        }
+        stats.events++;
+    }
+
+    stats.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    stats.hash = replay_hash;
+    stats.samples = replay_samples;
+    for (int i = 0; i < ReplayStage_Count; i++)
+        stats.stage[i] = std::chrono::duration<double>(replay_stage_time[i]).count();
+    stats.cache = pcm_cache_stats;
+
+    SPU2close();
+    SPU2shutdown();
+    fclose(file);
+
+    replay_profile = false;
+    replay_timestretch = false;
+    replay_mode = false;
+    return true;
+}
+
+// Plays a recording as fast as possible on the null output and reports the mixing speed,
+// the time spent in each stage and the output hash, to benchmark mixer changes without a
+// game. Block mixing follows the ini setting unless S2R_SAMPLE_MIXING is given, and the
+// timestretcher only runs with S2R_TIMESTRETCH.
+EXPORT_C_(void)
+s2r_benchmark(const char *filename, int flags)
+{
+    ReplayStats stats;
+
+    // SPU2init reads the ini, the settings we override are restored afterwards.
+    const bool block_mixing = BlockMixing;
+    const u32 output_module = OutputModule;
+    const int synch_mode = SynchMode;
+
+    ReadSettings();
+    const bool ok = s2r_replay_exact(filename, BlockMixing && !(flags & S2R_SAMPLE_MIXING), !!(flags & S2R_TIMESTRETCH), stats);
+
+    BlockMixing = block_mixing;
+    OutputModule = output_module;
+    SynchMode = synch_mode;
+
+    if (!ok)
+        return;
+
+    const double audio = stats.samples / 48000.0;
+    double staged = 0;
+    for (double time : stats.stage)
+        staged += time;
+
+    conprintf("%s: %d events, %llu samples (%.2f s of audio) in %.3f s\n", filename, stats.events, stats.samples, audio, stats.seconds);
+    conprintf("  %.0f samples/s (%.1fx realtime)\n", stats.samples / stats.seconds, audio / stats.seconds);
+    conprintf("  voices      %8.3f s\n", stats.stage[ReplayStage_Voices]);
+    conprintf("  reverb      %8.3f s\n", stats.stage[ReplayStage_Reverb]);
+    conprintf("  timestretch %8.3f s%s\n", stats.stage[ReplayStage_TimeStretch], (flags & S2R_TIMESTRETCH) ? "" : " (off)");
+    conprintf("  other       %8.3f s\n", stats.seconds - staged);
+    conprintf("  pcm cache   %llu hits, %llu misses, %llu prefetched, %llu invalidated\n",
+              stats.cache.Hits, stats.cache.Misses, stats.cache.Prefetched, stats.cache.Invalidated);
+    conprintf("  output hash %016llx\n", stats.hash);
+}
+
+#ifdef _MSC_VER
 u64 HighResFrequency()
 {
     u64 freq;
@@ -328,4 +503,26 @@ Finish:
 
     replay_mode = false;
 }
+
+// Replays a file once mixing sample by sample and once with block mixing, the output of
+// both must be bit identical.
+EXPORT_C_(void)
+s2r_compare(HWND hwnd, HINSTANCE hinst, LPSTR filename, int nCmdShow)
+{
+#ifdef _WIN32
+    AllocConsole();
+#endif
+
+    ReplayStats stats[2];
+
+    if (s2r_replay_exact(filename, false, false, stats[0]) && s2r_replay_exact(filename, true, false, stats[1])) {
+        conprintf("Sample mixing: %016llx\n", stats[0].hash);
+        conprintf("Block mixing:  %016llx\n", stats[1].hash);
+        conprintf(stats[0].hash == stats[1].hash ? "Identical.\n" : "MISMATCH!\n");
+    }
+
+#ifdef _WIN32
+    FreeConsole();
+#endif
+}
 #endif
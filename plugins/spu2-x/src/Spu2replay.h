@@ -18,6 +18,8 @@
 
 #pragma once
 
+#include <chrono>
+
 //#define S2R_ENABLE
 
 // s2r dumping
@@ -29,3 +31,44 @@ void s2r_writedma7(u32 ticks, u16 *data, u32 len);
 void s2r_close();
 
 extern bool replay_mode;
+
+// hash of the mixer output while replaying
+extern u64 replay_hash;
+extern u64 replay_samples;
+void s2r_hashsample(const StereoOut32 &sample);
+
+// Time spent in each mixer stage, only measured while benchmarking a replay.
+enum ReplayStage {
+    ReplayStage_Voices,
+    ReplayStage_Reverb,
+    ReplayStage_TimeStretch,
+    ReplayStage_Count
+};
+
+// s2r_benchmark flags
+#define S2R_SAMPLE_MIXING 1 // mix sample by sample even if block mixing is enabled
+#define S2R_TIMESTRETCH 2   // include the timestretcher
+
+extern bool replay_profile;
+extern bool replay_timestretch; // run the timestretcher on the null output
+extern std::chrono::steady_clock::duration replay_stage_time[ReplayStage_Count];
+
+class ReplayStageTimer
+{
+    ReplayStage m_stage;
+    std::chrono::steady_clock::time_point m_start;
+
+public:
+    ReplayStageTimer(ReplayStage stage)
+        : m_stage(stage)
+    {
+        if (replay_profile)
+            m_start = std::chrono::steady_clock::now();
+    }
+
+    ~ReplayStageTimer()
+    {
+        if (replay_profile)
+            replay_stage_time[m_stage] += std::chrono::steady_clock::now() - m_start;
+    }
+};
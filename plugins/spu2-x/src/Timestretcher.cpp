@@ -444,26 +444,6 @@ s32 SndBuffer::timeStretchOverrun()
     return SndOutPacketSize * 2;
 }
 
-static void CvtPacketToFloat(StereoOut32 *srcdest)
-{
-    StereoOutFloat *dest = (StereoOutFloat *)srcdest;
-    const StereoOut32 *src = (StereoOut32 *)srcdest;
-    for (uint i = 0; i < SndOutPacketSize; ++i, ++dest, ++src)
-        *dest = (StereoOutFloat)*src;
-}
-
-// Parameter note: Size should always be a multiple of 128, thanks!
-static void CvtPacketToInt(StereoOut32 *srcdest, uint size)
-{
-    //pxAssume( (size & 127) == 0 );
-
-    const StereoOutFloat *src = (StereoOutFloat *)srcdest;
-    StereoOut32 *dest = srcdest;
-
-    for (uint i = 0; i < size; ++i, ++dest, ++src)
-        *dest = (StereoOut32)*src;
-}
-
 void SndBuffer::timeStretchWrite()
 {
     // data prediction helps keep the tempo adjustments more accurate.
@@ -473,18 +453,14 @@ void SndBuffer::timeStretchWrite()
     // data prediction to make the timestretcher more responsive.
 
     PredictDataWrite((int)(SndOutPacketSize / eTempo));
-    CvtPacketToFloat(sndTempBuffer);
 
-    pSoundTouch->putSamples((float *)sndTempBuffer, SndOutPacketSize);
+    // SoundTouch works on floats, as does the output buffer, so its output goes straight in.
+    pSoundTouch->putSamples((float *)sndTempBufferFloat, SndOutPacketSize);
 
     int tempProgress;
-    while (tempProgress = pSoundTouch->receiveSamples((float *)sndTempBuffer, SndOutPacketSize),
+    while (tempProgress = pSoundTouch->receiveSamples((float *)sndTempBufferFloat, SndOutPacketSize),
            tempProgress != 0) {
-        // Hint: It's assumed that pSoundTouch will return chunks of 128 bytes (it always does as
-        // long as the SSE optimizations are enabled), which means we can do our own SSE opts here.
-
-        CvtPacketToInt(sndTempBuffer, tempProgress);
-        _WriteSamples(sndTempBuffer, tempProgress);
+        _WriteSamples(sndTempBufferFloat, tempProgress);
     }
 
 #ifdef SPU2X_USE_OLD_STRETCHER
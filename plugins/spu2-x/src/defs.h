@@ -567,14 +567,14 @@ extern s32 __fastcall SizeIt();
 // --------------------------------------------------------------------------------------
 
 // The SPU2 has a dynamic memory range which is used for several internal operations, such as
-// registers, CORE 1/2 mixing, AutoDMAs, and some other fancy stuff.  We exclude this range
-// from the cache here:
+// registers, CORE 1/2 mixing, AutoDMAs, and some other fancy stuff.  The mixer writes to it
+// every sample.
 static const s32 SPU2_DYN_MEMLINE = 0x2800;
 
 // 8 short words per encoded PCM block. (as stored in SPU2 ram)
 static const int pcm_WordsPerBlock = 8;
 
-// number of cachable ADPCM blocks (any blocks above the SPU2_DYN_MEMLINE)
+// number of cachable ADPCM blocks (the whole ram, every write invalidates its block)
 static const int pcm_BlockCount = 0x100000 / pcm_WordsPerBlock;
 
 // 28 samples per decoded PCM block (as stored in our cache)
@@ -587,3 +587,38 @@ struct PcmCacheEntry
 };
 
 extern PcmCacheEntry *pcm_cache_data;
+
+// Cache activity counters, shown every 10 seconds with the cache stats messages and totalled
+// by the replay benchmark.
+struct PcmCacheStats
+{
+    u64 Hits;        // blocks read from the cache
+    u64 Misses;      // blocks decoded by a voice
+    u64 Prefetched;  // blocks decoded ahead of the voices
+    u64 Invalidated; // decoded blocks dropped by a write to ram
+};
+
+extern PcmCacheStats pcm_cache_stats;
+
+// Every write to SPU2 ram must go through one of these, so that the voices never play a
+// stale decoded block.
+static __forceinline void InvalidatePcmCache(u32 addr)
+{
+    PcmCacheEntry &cacheLine = pcm_cache_data[addr / pcm_WordsPerBlock];
+    if (cacheLine.Validated) {
+        cacheLine.Validated = false;
+        pcm_cache_stats.Invalidated++;
+    }
+}
+
+// Words [start, end), end may be up to 0x100000.
+static __forceinline void InvalidatePcmCache(u32 start, u32 end)
+{
+    const PcmCacheEntry *cacheEnd = &pcm_cache_data[(end + pcm_WordsPerBlock - 1) / pcm_WordsPerBlock];
+    for (PcmCacheEntry *cacheLine = &pcm_cache_data[start / pcm_WordsPerBlock]; cacheLine < cacheEnd; cacheLine++) {
+        if (cacheLine->Validated) {
+            cacheLine->Validated = false;
+            pcm_cache_stats.Invalidated++;
+        }
+    }
+}
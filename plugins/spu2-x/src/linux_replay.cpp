@@ -0,0 +1,100 @@
+/* SPU2-X, A plugin for Emulating the Sound Processing Unit of the Playstation 2
+ * Developed and maintained by the Pcsx2 Development Team.
+ *
+ * SPU2-X is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Found-
+ * ation, either version 3 of the License, or (at your option) any later version.
+ *
+ * SPU2-X is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with SPU2-X.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Plays a .s2r recording through the plugin with the null output, as fast as possible,
+// and prints the mixing speed, per stage timings and the output hash.
+
+#include <dlfcn.h>
+#include <cstdlib>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+// Keep in sync with Spu2replay.h
+#define S2R_SAMPLE_MIXING 1
+#define S2R_TIMESTRETCH 2
+
+static void *handle;
+
+void help()
+{
+    fprintf(stderr, "Loader s2r file\n");
+    fprintf(stderr, "ARG1 SPU2-X plugin\n");
+    fprintf(stderr, "ARG2 .s2r file\n");
+    fprintf(stderr, "ARG3 Ini directory (optional)\n");
+    fprintf(stderr, "-s   mix sample by sample instead of in blocks\n");
+    fprintf(stderr, "-t   include the timestretcher\n");
+    if (handle) {
+        dlclose(handle);
+    }
+    exit(1);
+}
+
+int main(int argc, char *argv[])
+{
+    const char *args[3] = {};
+    int nargs = 0;
+    int flags = 0;
+
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "-s"))
+            flags |= S2R_SAMPLE_MIXING;
+        else if (!strcmp(argv[i], "-t"))
+            flags |= S2R_TIMESTRETCH;
+        else if (nargs < 3)
+            args[nargs++] = argv[i];
+        else
+            help();
+    }
+
+    if (nargs < 2)
+        help();
+
+    handle = dlopen(args[0], RTLD_LAZY | RTLD_GLOBAL);
+    if (handle == NULL) {
+        fprintf(stderr, "Failed to dlopen plugin %s (%s)\n", args[0], dlerror());
+        help();
+    }
+
+    __attribute__((stdcall)) void (*SPU2setSettingsDir_ptr)(const char *);
+    __attribute__((stdcall)) void (*SPU2replayBenchmark_ptr)(const char *, int);
+
+    SPU2setSettingsDir_ptr = reinterpret_cast<decltype(SPU2setSettingsDir_ptr)>(dlsym(handle, "SPU2setSettingsDir"));
+    SPU2replayBenchmark_ptr = reinterpret_cast<decltype(SPU2replayBenchmark_ptr)>(dlsym(handle, "s2r_benchmark"));
+
+    if (!SPU2setSettingsDir_ptr || !SPU2replayBenchmark_ptr) {
+        fprintf(stderr, "The plugin does not export the replay functions\n");
+        help();
+    }
+
+    if (nargs == 3) {
+        SPU2setSettingsDir_ptr(args[2]);
+    } else {
+#ifdef XDG_STD
+        char *val = getenv("HOME");
+        if (val) {
+            std::string ini_dir(val);
+            ini_dir += "/.config/pcsx2/inis";
+
+            SPU2setSettingsDir_ptr(ini_dir.c_str());
+        }
+#endif
+    }
+
+    SPU2replayBenchmark_ptr(args[1], flags);
+
+    dlclose(handle);
+    return 0;
+}
@@ -77,13 +77,11 @@ __forceinline void spu2M_Write(u32 addr, s16 value)
     // (note to self : addr address WORDs, not bytes)
 
     addr &= 0xfffff;
-    if (addr >= SPU2_DYN_MEMLINE) {
-        const int cacheIdx = addr / pcm_WordsPerBlock;
-        pcm_cache_data[cacheIdx].Validated = false;
+    InvalidatePcmCache(addr);
+
+    if (MsgToConsole() && MsgCache())
+        ConLog("* SPU2-X: PcmCache Block Clear at 0x%x (cacheIdx=0x%x)\n", addr, addr / pcm_WordsPerBlock);
 
-        if (MsgToConsole() && MsgCache())
-            ConLog("* SPU2-X: PcmCache Block Clear at 0x%x (cacheIdx=0x%x)\n", addr, cacheIdx);
-    }
     *GetMemPtr(addr) = value;
 }
 
@@ -450,6 +448,16 @@ __forceinline void TimeUpdate(u32 cClocks)
                         if (Cores[i].Voices[j].Start())
                             Cores[i].KeyOn &= ~(1 << j);
 
+        // Nothing but the samples themselves can happen until the end of this update or the
+        // next DMA interrupt, so let the mixer run the voices of these samples in one go.
+        if (BlockMixing && !Cores[0].KeyOn && !Cores[1].KeyOn) {
+            uint samples = dClocks / TickInterval + 1;
+            for (int i = 0; i < 2; i++)
+                if (Cores[i].DMAICounter > 0)
+                    samples = std::min<uint>(samples, (Cores[i].DMAICounter - 1) / TickInterval + 1);
+            PrepareVoiceBlock(samples);
+        }
+
         // Note: IOP does not use MMX regs, so no need to save them.
         //SaveMMXRegs();
         Mix();
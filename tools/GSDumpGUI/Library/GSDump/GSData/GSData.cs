@@ -38,6 +38,7 @@ namespace GSDumpGUI
         Transfer = 0,
         VSync = 1,
         ReadFIFO2 = 2,
-        Registers = 3
+        Registers = 3,
+        Snapshot = 4
     }
 }
@@ -144,6 +144,11 @@ namespace GSDumpGUI
                         dataRR.data = br.ReadBytes(8192);
                         dmp.Data.Add(dataRR);
                         break;
+                    case GSType.Snapshot:
+                        // State snapshot for the replayer's seeking, not needed here
+                        Int32 sS = br.ReadInt32();
+                        br.ReadBytes(sS);
+                        break;
                     default:
                         break;
                 }